@@ -65,7 +65,9 @@ struct request {
 struct response {
    std::int64_t request_id{};
    request_result result{};
-   std::optional<phone_book> contacts{};
+
+   // The phone book is sent as is, without re-encoding it for every response
+   std::optional<cbor::encoded<phone_book>> contacts{};
 };
 
 } // namespace get_contacts
@@ -101,21 +103,23 @@ auto hex(const T &v) {
 // Dummy "server": it owns a phone book and provides a request-based API for modifying it.
 class server {
 public:
+   server() { update_encoded_phone_book(); }
+
    // Pretend we are processing a network payload: we get a request message and a buffer for putting a response into it.
    void handle_message(std::span<const std::byte> message, std::vector<std::byte> &response) {
-      // Decode a request
+      // Decode a request and directly call an appropriate handler with the encoded alternative
       cbor::read_buffer buf{message};
-      request_t r{};
-      if (auto res = cbor::decode(buf, r)) {
-         throw std::system_error{res};
-      }
+      auto res = cbor::decode_visit<request_t>(buf, [&](const auto &r) {
+         if (message.size() != buf.read_position()) {
+            throw std::runtime_error("Trailing bytes after message");
+         }
 
-      if (message.size() != buf.read_position()) {
-         throw std::runtime_error("Trailing bytes after message");
-      }
+         this->handle(r, response);
+      });
 
-      // Call an appropriate handler based on the currently active variant alternative
-      std::visit([&](const auto &r) { this->handle(r, response); }, r);
+      if (res) {
+         throw std::system_error{res};
+      }
    }
 
 private:
@@ -124,6 +128,7 @@ private:
       // Simply append a new contact to the current phone book
       const auto count = phone_book_.contacts.size();
       phone_book_.contacts.push_back(r.value);
+      update_encoded_phone_book();
 
       // Prepare a response
       out.resize(0);
@@ -151,7 +156,7 @@ private:
       response_t msg{get_contacts::response{
          .request_id = r.id,
          .result = request_result::success,
-         .contacts = {phone_book_}, // Simply copy the whole phone book
+         .contacts = {encoded_phone_book_}, // Just share the already encoded phone book
       }};
 
       if (auto res = cbor::encode(buf, msg)) {
@@ -161,8 +166,16 @@ private:
       std::cout << "<- Get contacts response: " << hex(out) << std::endl;
    }
 
+   // The phone book is changed way less often than it is requested, so we only encode it once per change
+   void update_encoded_phone_book() {
+      if (auto res = encoded_phone_book_.assign(phone_book_)) {
+         throw std::system_error{res};
+      }
+   }
+
 private:
    phone_book phone_book_{};
+   cbor::encoded<phone_book> encoded_phone_book_{};
 };
 
 // Dummy "client": it tries to retrieve the phone book from the server using the requests API.
@@ -253,7 +266,12 @@ private:
          return;
       }
 
-      const auto &contacts = (*r.contacts).contacts;
+      phone_book book{};
+      if (auto res = r.contacts->decode_value(book)) {
+         throw std::system_error{res};
+      }
+
+      const auto &contacts = book.contacts;
       if (contacts.empty()) {
          std::cout << "Phone book: [empty]\n";
          return;
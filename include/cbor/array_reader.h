@@ -0,0 +1,177 @@
+/**
+ * @file   array_reader.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/decoding.h>
+#include <cbor/error.h>
+
+#include <cstdint>
+#include <iterator>
+
+namespace cbor {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: array_reader
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Array reader - decodes the elements of an array one at a time, instead of materializing the whole array.
+ *
+ * Only a single element is held at any time, so arbitrary large arrays can be processed with constant memory, and
+ * stopping early doesn't require decoding the rest of the array.
+ *
+ * The reader is an input range: iterating over it decodes the next element on each step, and stops at the end of the
+ * array or at the first decoding error (see last_error()).
+ *
+ * @code{.cpp}
+ * cbor::array_reader<sample> samples{};
+ * if (auto res = samples.open(buf)) { ... }
+ *
+ * for (const auto &s : samples) {
+ *    process(s);
+ * }
+ *
+ * if (samples.last_error()) { ... }
+ * @endcode
+ *
+ * @tparam T Element type.
+ */
+template <typename T>
+class array_reader {
+public:
+   using value_type = T;
+
+   class iterator {
+   public:
+      using iterator_concept = std::input_iterator_tag;
+      using value_type = T;
+      using difference_type = std::ptrdiff_t;
+
+   public:
+      iterator() = default;
+
+      explicit iterator(array_reader &reader)
+         : reader_{&reader} {
+         advance();
+      }
+
+   public:
+      const T &operator*() const { return reader_->current_; }
+      const T *operator->() const { return &reader_->current_; }
+
+      iterator &operator++() {
+         advance();
+         return *this;
+      }
+
+      void operator++(int) { advance(); }
+
+      bool operator==(std::default_sentinel_t) const { return reader_ == nullptr; }
+
+   private:
+      void advance() {
+         if (reader_->remaining() == 0 || reader_->next(reader_->current_)) {
+            reader_ = nullptr;
+         }
+      }
+
+   private:
+      array_reader *reader_{nullptr};
+   };
+
+public:
+   /**
+    * Read the array head.
+    * @param buf Buffer, positioned at the array head. Has to outlive the reader.
+    * @return Operation result. The buffer is left untouched on failure.
+    */
+   [[nodiscard]] std::error_code open(read_buffer &buf) {
+      auto rollback_helper = buf.get_rollback_helper();
+
+      detail::head head{};
+      auto res = head.read(buf);
+      if (res) {
+         return res;
+      }
+
+      if (head.type != major_type::array) {
+         return error::unexpected_type;
+      }
+
+      if (head.is_indefinite()) {
+         // Indefinite-length items are not supported by this library
+         return error::decoding_error;
+      }
+
+      buf_ = &buf;
+      size_ = head.decode_argument();
+      position_ = 0;
+      error_ = {};
+
+      rollback_helper.commit();
+      return error::success;
+   }
+
+   /**
+    * Decode the next element.
+    * @param v Value to decode into, reset before decoding (some decoders, e.g. for dictionaries, only extend the value).
+    * @return Operation result, invalid_usage if there are no elements left.
+    */
+   [[nodiscard]] std::error_code next(T &v) {
+      if (remaining() == 0) {
+         return error::invalid_usage;
+      }
+
+      v = T{};
+      error_ = decode(*buf_, v);
+      if (error_) {
+         // The read position is unknown, so the rest of the array can't be read anymore
+         return error_;
+      }
+
+      ++position_;
+      return error::success;
+   }
+
+   /**
+    * Skip the remaining elements without decoding them, moving the buffer to the end of the array.
+    * @return Operation result.
+    */
+   [[nodiscard]] std::error_code skip_rest() {
+      while (remaining() != 0) {
+         auto res = skip(*buf_);
+         if (res) {
+            error_ = res;
+            return res;
+         }
+         ++position_;
+      }
+
+      return error::success;
+   }
+
+   [[nodiscard]] iterator begin() { return iterator{*this}; }
+   [[nodiscard]] std::default_sentinel_t end() const { return {}; }
+
+   //! Total number of elements in the array
+   [[nodiscard]] std::uint64_t size() const { return size_; }
+
+   //! Number of elements not yet decoded (zero after a failure)
+   [[nodiscard]] std::uint64_t remaining() const { return error_ ? 0 : size_ - position_; }
+
+   //! First element decoding failure
+   [[nodiscard]] std::error_code last_error() const { return error_; }
+
+private:
+   read_buffer *buf_{nullptr};
+   std::uint64_t size_{0};
+   std::uint64_t position_{0};
+   std::error_code error_{};
+   T current_{};
+};
+
+} // namespace cbor
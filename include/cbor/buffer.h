@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cbor/config.h>
 #include <cbor/error.h>
 #include <cbor/export.h>
 
@@ -235,7 +236,12 @@ public:
    [[nodiscard]] std::error_code read(std::byte &v);
    [[nodiscard]] std::error_code read(buffer::span_t v);
 
+   //! Advance the read position by the specified number of bytes, without copying them out.
+   [[nodiscard]] std::error_code skip(std::size_t size);
+
    [[nodiscard]] std::ptrdiff_t read_position() const { return read_position_; }
+   [[nodiscard]] std::size_t size() const { return span_.size(); }
+   [[nodiscard]] buffer::const_span_t span() const { return span_; }
    void reset(std::ptrdiff_t position = 0) { read_position_ = position; }
 
    [[nodiscard]] rollback_helper get_rollback_helper() { return rollback_helper(*this); }
@@ -245,4 +251,8 @@ private:
    std::ptrdiff_t read_position_{0};
 };
 
-} // namespace cbor
\ No newline at end of file
+} // namespace cbor
+
+#if CBOR_WITH(HEADER_ONLY_CODEC)
+#include <cbor/impl/read_buffer.h>
+#endif
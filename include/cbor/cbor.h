@@ -6,5 +6,18 @@
 
 #pragma once
 
+#include <cbor/array_reader.h>
+#include <cbor/constant.h>
+#include <cbor/encoded.h>
+#include <cbor/encoded_array.h>
 #include <cbor/encoding.h>
+#include <cbor/event_parser.h>
 #include <cbor/decoding.h>
+#include <cbor/field_update.h>
+#include <cbor/fixed_string.h>
+#include <cbor/mapped_file.h>
+#include <cbor/schema.h>
+#include <cbor/sequence.h>
+#include <cbor/size_predictor.h>
+#include <cbor/small_buffer.h>
+#include <cbor/static_vector.h>
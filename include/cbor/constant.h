@@ -0,0 +1,395 @@
+/**
+ * @file   constant.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/encoding.h>
+#include <cbor/type_traits.h>
+
+#include <array>
+#include <bit>
+#include <bitset>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace cbor {
+
+namespace detail {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: constant_writer
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Constant writer - compile-time counterpart of a buffer.
+ *
+ * Without a target it only counts the written bytes, which is used to determine the size of a constant message.
+ */
+class constant_writer {
+public:
+   constexpr constant_writer() = default;
+
+   constexpr explicit constant_writer(std::byte *target)
+      : target_{target} {
+      // Nothing to do here
+   }
+
+public:
+   constexpr void write(std::byte b) {
+      if (target_) {
+         target_[size_] = b;
+      }
+      ++size_;
+   }
+
+   [[nodiscard]] constexpr std::size_t size() const { return size_; }
+
+private:
+   std::byte *target_{nullptr};
+   std::size_t size_{0};
+};
+
+template <typename T>
+concept ConstantEncodable = requires(constant_writer &w, const T &t) { encode_constant(w, t); };
+
+//! Write a head with an argument of the specified size, matching detail::encode_argument(..., compress = false)
+constexpr void encode_constant_head(constant_writer &w, major_type type, argument_size size, std::uint64_t argument) {
+   w.write(type | size);
+
+   std::size_t num_bytes = 0;
+   switch (size) {
+      case argument_size::one_byte:
+         num_bytes = 1;
+         break;
+      case argument_size::two_bytes:
+         num_bytes = 2;
+         break;
+      case argument_size::four_bytes:
+         num_bytes = 4;
+         break;
+      case argument_size::eight_bytes:
+         num_bytes = 8;
+         break;
+      default:
+         break;
+   }
+
+   for (std::size_t i = num_bytes; i > 0; --i) {
+      w.write(static_cast<std::byte>((argument >> ((i - 1) * 8U)) & 0xFFU));
+   }
+}
+
+//! Write a head with the shortest possible argument, matching cbor::encode_argument
+constexpr void encode_constant_head(constant_writer &w, major_type type, std::uint64_t argument) {
+   if (argument <= ZERO_EXTRA_BYTES_VALUE_LIMIT) {
+      w.write((type | argument_size::no_bytes) | static_cast<std::uint8_t>(argument));
+   } else if (argument <= ONE_EXTRA_BYTE_VALUE_LIMIT) {
+      encode_constant_head(w, type, argument_size::one_byte, argument);
+   } else if (argument <= TWO_EXTRA_BYTES_VALUE_LIMIT) {
+      encode_constant_head(w, type, argument_size::two_bytes, argument);
+   } else if (argument <= FOUR_EXTRA_BYTES_VALUE_LIMIT) {
+      encode_constant_head(w, type, argument_size::four_bytes, argument);
+   } else {
+      encode_constant_head(w, type, argument_size::eight_bytes, argument);
+   }
+}
+
+/**
+ * Check if a float can be represented as a half-float without losing precision.
+ * @param v Finite float value.
+ * @param[out] half Binary half-float representation.
+ * @return true if the value is exactly representable.
+ */
+constexpr bool to_exact_half(float v, std::uint16_t &half) {
+   const auto bits = std::bit_cast<std::uint32_t>(v);
+   const auto sign = static_cast<std::uint16_t>((bits >> 16U) & 0x8000U);
+   const auto exponent = static_cast<std::int32_t>((bits >> 23U) & 0xFFU);
+   const auto mantissa = bits & 0x7FFFFFU;
+
+   if (exponent == 0) {
+      // Zeroes are representable, float subnormals are way too small for a half-float
+      half = sign;
+      return mantissa == 0;
+   }
+
+   const auto unbiased = exponent - 127;
+   if (unbiased > 15 || unbiased < -24) {
+      return false;
+   }
+
+   if (unbiased >= -14) {
+      // Normal half-float: 10 bits of mantissa
+      if ((mantissa & 0x1FFFU) != 0) {
+         return false;
+      }
+
+      half = static_cast<std::uint16_t>(sign | ((unbiased + 15) << 10U) | (mantissa >> 13U));
+      return true;
+   }
+
+   // Subnormal half-float: value = m * 2^-24
+   const auto full = mantissa | 0x800000U;
+   const auto shift = static_cast<std::uint32_t>(-unbiased - 1);
+   if ((full & ((1U << shift) - 1U)) != 0) {
+      return false;
+   }
+
+   half = static_cast<std::uint16_t>(sign | (full >> shift));
+   return true;
+}
+
+//! Deterministic encodings of special float values, matching the runtime encoder
+constexpr bool encode_constant_special(constant_writer &w, auto v) {
+   using float_t = decltype(v);
+
+   std::uint16_t half = 0;
+   if (v != v) {
+      half = 0x7E00U;
+   } else if (v == std::numeric_limits<float_t>::infinity()) {
+      half = 0x7C00U;
+   } else if (v == -std::numeric_limits<float_t>::infinity()) {
+      half = 0xFC00U;
+   } else {
+      return false;
+   }
+
+   encode_constant_head(w, major_type::simple, argument_size::two_bytes, half);
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Integers and enums
+////////////////////////////////////////////////////////////////////////////////
+template <UnsignedInt T>
+constexpr void encode_constant(constant_writer &w, T v) {
+   encode_constant_head(w, major_type::unsigned_int, static_cast<std::uint64_t>(v));
+}
+
+template <SignedInt T>
+constexpr void encode_constant(constant_writer &w, T v) {
+   using unsigned_t = std::make_unsigned_t<T>;
+   if (v < 0) {
+      const auto argument = static_cast<unsigned_t>(static_cast<T>(-1) - v);
+      encode_constant_head(w, major_type::signed_int, static_cast<std::uint64_t>(argument));
+   } else {
+      encode_constant_head(w, major_type::unsigned_int, static_cast<std::uint64_t>(v));
+   }
+}
+
+template <Enum T>
+constexpr void encode_constant(constant_writer &w, T v) {
+   encode_constant(w, static_cast<std::underlying_type_t<T>>(v));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Byte arrays and strings
+////////////////////////////////////////////////////////////////////////////////
+constexpr void encode_constant(constant_writer &w, buffer::const_span_t v) {
+   encode_constant_head(w, major_type::byte_string, v.size());
+   for (auto b : v) {
+      w.write(b);
+   }
+}
+
+constexpr void encode_constant(constant_writer &w, std::string_view v) {
+   encode_constant_head(w, major_type::text_string, v.size());
+   for (auto c : v) {
+      w.write(static_cast<std::byte>(c));
+   }
+}
+
+constexpr void encode_constant(constant_writer &w, const char *v) {
+   encode_constant(w, std::string_view{v});
+}
+
+template <typename Traits, typename Allocator>
+constexpr void encode_constant(constant_writer &w, const std::basic_string<char, Traits, Allocator> &v) {
+   encode_constant(w, std::string_view{v});
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Simple types
+////////////////////////////////////////////////////////////////////////////////
+constexpr void encode_constant(constant_writer &w, bool v) {
+   w.write(major_type::simple | (v ? simple_type::true_type : simple_type::false_type));
+}
+
+constexpr void encode_constant(constant_writer &w, std::nullptr_t) {
+   w.write(major_type::simple | simple_type::null_type);
+}
+
+template <ConstantEncodable T>
+constexpr void encode_constant(constant_writer &w, const std::optional<T> &v) {
+   if (!v.has_value()) {
+      encode_constant(w, nullptr);
+   } else {
+      encode_constant(w, *v);
+   }
+}
+
+constexpr void encode_constant(constant_writer &w, float v) {
+   if (encode_constant_special(w, v)) {
+      return;
+   }
+
+   std::uint16_t half = 0;
+   if (to_exact_half(v, half)) {
+      encode_constant_head(w, major_type::simple, argument_size::two_bytes, half);
+   } else {
+      encode_constant_head(w, major_type::simple, argument_size::four_bytes, std::bit_cast<std::uint32_t>(v));
+   }
+}
+
+constexpr void encode_constant(constant_writer &w, double v) {
+   if (encode_constant_special(w, v)) {
+      return;
+   }
+
+   // Narrowing an out-of-range double is not a constant expression
+   constexpr auto float_max = static_cast<double>(std::numeric_limits<float>::max());
+   if (v >= -float_max && v <= float_max && static_cast<double>(static_cast<float>(v)) == v) {
+      encode_constant(w, static_cast<float>(v));
+   } else {
+      encode_constant_head(w, major_type::simple, argument_size::eight_bytes, std::bit_cast<std::uint64_t>(v));
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Variants
+////////////////////////////////////////////////////////////////////////////////
+template <typename... T>
+   requires AllWithTypeID<T...> && (ConstantEncodable<T> && ...)
+constexpr void encode_constant(constant_writer &w, const std::variant<T...> &v) {
+   static_assert(all_alternatives_are_unique<T...>(), "TypeID duplicates are not allowed for variant alternatives");
+
+   std::visit(
+      [&w](const auto &unwrapped) {
+         constexpr const auto &prefix = variant_prefix_v<std::variant<T...>, decltype(unwrapped)>;
+         for (std::size_t i = 0; i < prefix.size; ++i) {
+            w.write(prefix.data[i]);
+         }
+
+         encode_constant(w, unwrapped);
+      },
+      v);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Structs
+////////////////////////////////////////////////////////////////////////////////
+template <EncodableStruct T>
+constexpr void encode_constant(constant_writer &w, const T &v) {
+   encode_constant_head(w, major_type::array, get_member_count<T>());
+
+   [&]<std::size_t... Ns>(std::index_sequence<Ns...>) {
+      (encode_constant(w, get_member<Ns>(v)), ...);
+   }(std::make_index_sequence<get_member_count<T>()>{});
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Arrays
+////////////////////////////////////////////////////////////////////////////////
+template <IsByte T, std::size_t Extent>
+constexpr void encode_constant(constant_writer &w, std::span<const T, Extent> v) {
+   encode_constant_head(w, major_type::byte_string, v.size());
+   for (auto e : v) {
+      w.write(static_cast<std::byte>(e));
+   }
+}
+
+template <ConstantEncodable T, std::size_t Extent>
+   requires(!IsByte<T>)
+constexpr void encode_constant(constant_writer &w, std::span<const T, Extent> v) {
+   encode_constant_head(w, major_type::array, v.size());
+   for (const auto &e : v) {
+      encode_constant(w, e);
+   }
+}
+
+template <ConstantEncodable T, std::size_t Extent>
+constexpr void encode_constant(constant_writer &w, const std::array<T, Extent> &v) {
+   encode_constant(w, std::span{v});
+}
+
+template <ConstantEncodable T, typename Allocator>
+constexpr void encode_constant(constant_writer &w, const std::vector<T, Allocator> &v) {
+   static_assert(!is_columnar_v<T>, "Columnar vectors can't be encoded at compile-time");
+   encode_constant(w, std::span{v});
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Bit vectors
+////////////////////////////////////////////////////////////////////////////////
+template <typename Container>
+constexpr void encode_constant_bits(constant_writer &w, const Container &v, std::size_t size) {
+   const auto num_bytes = (size + 7) / 8;
+   encode_constant_head(w, major_type::byte_string, num_bytes + 1);
+   w.write(static_cast<std::byte>(num_bytes * 8 - size));
+
+   for (std::size_t i = 0; i < num_bytes; ++i) {
+      std::uint8_t packed = 0;
+      for (std::size_t j = 0; j < 8 && i * 8 + j < size; ++j) {
+         packed |= static_cast<std::uint8_t>(static_cast<std::uint8_t>(v[i * 8 + j]) << j);
+      }
+      w.write(std::byte{packed});
+   }
+}
+
+template <typename Allocator>
+constexpr void encode_constant(constant_writer &w, const std::vector<bool, Allocator> &v) {
+   encode_constant_bits(w, v, v.size());
+}
+
+template <std::size_t N>
+constexpr void encode_constant(constant_writer &w, const std::bitset<N> &v) {
+   encode_constant_bits(w, v, N);
+}
+
+} // namespace detail
+
+/**
+ * Encode a constant message at compile time.
+ *
+ * Supports the same types as the runtime encoder (with the same encoding), except for dictionaries. For structs without
+ * Boost PFR, the get_member specializations have to be constexpr.
+ *
+ * @code{.cpp}
+ * static constexpr auto heartbeat = cbor::encode_constant([] { return heartbeat_message{.version = 1}; });
+ * socket.send(heartbeat);
+ * @endcode
+ *
+ * @param factory Capture-less lambda (or any other default-constructible callable), returning the value to be encoded.
+ * @return Encoded value.
+ */
+template <typename Factory>
+   requires std::default_initializable<Factory> && std::invocable<Factory>
+[[nodiscard]] consteval auto encode_constant(Factory) {
+   using value_t = std::remove_cvref_t<std::invoke_result_t<Factory>>;
+   static_assert(detail::ConstantEncodable<value_t>, "Value is not encodable at compile time");
+
+   constexpr auto size = [] {
+      detail::constant_writer counter{};
+      encode_constant(counter, Factory{}());
+      return counter.size();
+   }();
+
+   std::array<std::byte, size> result{};
+   detail::constant_writer w{result.data()};
+   encode_constant(w, Factory{}());
+   return result;
+}
+
+} // namespace cbor
@@ -0,0 +1,100 @@
+/**
+ * @file   cpu_dispatch.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/export.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace cbor::cpu {
+
+/**
+ * Instruction set tiers of the vector kernels, ordered from the least to the most capable one.
+ *
+ * The CPU features are detected once, on the first use. The SIMD tiers are only available for x86 builds with GCC or
+ * Clang, everything else always runs the baseline kernels.
+ *
+ * The active tier can be capped by setting the CBOR_CPU_LEVEL environment variable to one of the level names (see
+ * to_string()), which is useful for testing and benchmarking each tier on the same machine. Levels above the detected
+ * one are never used.
+ */
+enum class level : std::uint8_t {
+   baseline = 0, //! Portable scalar code
+   sse4_2,       //! SSE4.2
+   avx2,         //! AVX2
+   avx512,       //! AVX-512F and AVX-512BW
+};
+
+//! Individual CPU features, as reported by the cpuid instruction (and supported by the OS)
+struct features {
+   bool sse4_2{false};
+   bool avx2{false};
+   bool avx512f{false};
+   bool avx512bw{false};
+};
+
+//! Kernel table of a single level
+struct kernels {
+   level tier;
+
+   std::uint8_t (*max_u8)(const std::uint8_t *v, std::size_t size);
+   std::uint16_t (*max_u16)(const std::uint16_t *v, std::size_t size);
+   std::uint32_t (*max_u32)(const std::uint32_t *v, std::size_t size);
+   std::uint64_t (*max_u64)(const std::uint64_t *v, std::size_t size);
+
+   std::size_t (*small_int_run)(const std::uint8_t *v, std::size_t size);
+};
+
+//! Name of the level, as used by the CBOR_CPU_LEVEL environment variable ("baseline", "sse4.2", "avx2" or "avx512")
+[[nodiscard]] CBOR_EXPORT std::string_view to_string(level l);
+
+[[nodiscard]] CBOR_EXPORT std::optional<level> parse_level(std::string_view name);
+
+[[nodiscard]] CBOR_EXPORT const features &detected_features();
+
+//! Most capable level supported by the CPU
+[[nodiscard]] CBOR_EXPORT level detected_level();
+
+//! Level used by the codec: the detected level, capped by the CBOR_CPU_LEVEL environment variable
+[[nodiscard]] CBOR_EXPORT level active_level();
+
+//! Kernels of the specified level, or of the detected level, if the requested one is not supported
+[[nodiscard]] CBOR_EXPORT const kernels &kernels_for(level l);
+
+//! Kernels of the active level
+[[nodiscard]] CBOR_EXPORT const kernels &active_kernels();
+
+//! Largest value in a span (zero for empty spans), using the active kernels
+inline std::uint8_t max_value(std::span<const std::uint8_t> v) {
+   return active_kernels().max_u8(v.data(), v.size());
+}
+
+inline std::uint16_t max_value(std::span<const std::uint16_t> v) {
+   return active_kernels().max_u16(v.data(), v.size());
+}
+
+inline std::uint32_t max_value(std::span<const std::uint32_t> v) {
+   return active_kernels().max_u32(v.data(), v.size());
+}
+
+inline std::uint64_t max_value(std::span<const std::uint64_t> v) {
+   return active_kernels().max_u64(v.data(), v.size());
+}
+
+/**
+ * Length of the leading run of single-byte integers: unsigned or negative integers with the value encoded in the
+ * initial byte. Every such byte is a complete data item. Uses the active kernels.
+ */
+inline std::size_t small_int_run(std::span<const std::uint8_t> v) {
+   return active_kernels().small_int_run(v.data(), v.size());
+}
+
+} // namespace cbor::cpu
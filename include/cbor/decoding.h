@@ -9,7 +9,13 @@
 #include <cbor/buffer.h>
 #include <cbor/encoding.h>
 
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <bitset>
+#include <cstring>
+#include <span>
+#include <type_traits>
 #include <utility>
 #include <variant>
 
@@ -36,8 +42,62 @@ struct CBOR_EXPORT head {
    [[nodiscard]] std::error_code read(read_buffer &buf);
 
    [[nodiscard]] std::uint64_t decode_argument() const;
+
+   //! Indefinite-length items (not supported by this library) are marked with the additional information of 31
+   [[nodiscard]] bool is_indefinite() const { return (raw & 0x1F) == 0x1F; }
 };
 
+/**
+ * Check that a container of the specified size can possibly fit into the rest of the buffer.
+ *
+ * Every item takes up at least one byte, so containers claiming more items than there are bytes left are rejected
+ * before anything is allocated, which also protects item counters from overflowing.
+ *
+ * @param buf Buffer, positioned after the container head.
+ * @param size Number of container elements.
+ * @param items_per_element Number of items in a single element (e.g., 2 for a dictionary key and value).
+ * @return Operation result, buffer_underflow if the container can't fit.
+ */
+[[nodiscard]] inline std::error_code check_remaining(const read_buffer &buf,
+                                                     std::uint64_t size,
+                                                     std::uint64_t items_per_element = 1) {
+   const std::uint64_t remaining = buf.size() - buf.read_position();
+   if (size > remaining / items_per_element) {
+      return error::buffer_underflow;
+   }
+   return error::success;
+}
+
+/**
+ * Consume the specified number of bytes, without copying them out.
+ *
+ * Allows the containers to be filled directly from the source memory (e.g., with assign()), instead of
+ * value-initializing them first and overwriting the contents with a read.
+ *
+ * @param[in] buf Source buffer.
+ * @param[in] size Number of bytes to consume.
+ * @param[out] v Consumed bytes, referencing the source buffer memory.
+ * @return Operation result.
+ */
+[[nodiscard]] inline std::error_code read_view(read_buffer &buf, std::uint64_t size, buffer::const_span_t &v) {
+   if (size == 0) {
+      v = {};
+      return error::success;
+   }
+
+   if (!buf.span().data()) {
+      return error::invalid_usage;
+   }
+
+   const auto position = static_cast<std::size_t>(buf.read_position());
+   if (size > buf.size() - position) {
+      return error::buffer_underflow;
+   }
+
+   v = buf.span().subspan(position, static_cast<std::size_t>(size));
+   return buf.skip(static_cast<std::size_t>(size));
+}
+
 } // namespace detail
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -126,11 +186,12 @@ template <Enum T>
 ////////////////////////////////////////////////////////////////////////////////
 /// Byte Arrays
 ////////////////////////////////////////////////////////////////////////////////
-template <typename Allocator, typename VectorT = std::vector<std::byte, Allocator>>
+template <IsByte T, typename Allocator, typename VectorT = std::vector<T, Allocator>>
 [[nodiscard]] std::error_code decode(read_buffer &buf,
-                                     std::vector<std::byte, Allocator> &v,
+                                     std::vector<T, Allocator> &v,
                                      max_size_t<VectorT> max_size = max_size_v<VectorT>) {
    static_assert(max_int_v<std::uint64_t> <= max_size_v<VectorT>);
+   static_assert(sizeof(T) == sizeof(std::byte));
 
    detail::head head{};
    auto res = head.read(buf);
@@ -147,19 +208,23 @@ template <typename Allocator, typename VectorT = std::vector<std::byte, Allocato
       return error::buffer_overflow;
    }
 
-   v.resize(u64);
-
-   if (u64 != 0) {
-      return buf.read(buffer::span_t{v});
+   buffer::const_span_t bytes{};
+   res = detail::read_view(buf, u64, bytes);
+   if (res) {
+      return res;
    }
 
+   // Copy directly into the (possibly uninitialized) storage, instead of zero-filling it with resize() first
+   const auto first = reinterpret_cast<const T *>(bytes.data());
+   v.assign(first, first + bytes.size());
    return error::success;
 }
 
-template <std::size_t Extent>
-[[nodiscard]] std::error_code decode(read_buffer &buf, std::array<std::byte, Extent> &v) {
-   using array_t = std::array<std::byte, Extent>;
+template <IsByte T, std::size_t Extent>
+[[nodiscard]] std::error_code decode(read_buffer &buf, std::array<T, Extent> &v) {
+   using array_t = std::array<T, Extent>;
    static_assert(max_int_v<std::uint64_t> <= max_size_v<array_t>);
+   static_assert(sizeof(T) == sizeof(std::byte));
 
    detail::head head{};
    auto res = head.read(buf);
@@ -181,15 +246,37 @@ template <std::size_t Extent>
    }
 
    if (u64 != 0) {
-      return buf.read(buffer::span_t{v});
+      return buf.read(buffer::span_t{reinterpret_cast<std::byte *>(v.data()), v.size()});
    }
 
    return error::success;
 }
 
+/**
+ * Decode a byte string of a variable length into a caller-provided memory, without any allocations.
+ *
+ * @param[in] buf Buffer to decode the value from.
+ * @param[out] out Target memory, the byte string has to fit into it.
+ * @param[out] len Number of bytes, written to the target memory.
+ * @return Operation result, error::buffer_overflow if the byte string is larger than the target memory.
+ */
+[[nodiscard]] CBOR_EXPORT std::error_code decode(read_buffer &buf, buffer::span_t out, std::size_t &len);
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Strings
 ////////////////////////////////////////////////////////////////////////////////
+/**
+ * Decode a text string of a variable length into a caller-provided memory, without any allocations.
+ *
+ * The string is not null-terminated.
+ *
+ * @param[in] buf Buffer to decode the value from.
+ * @param[out] out Target memory, the text string has to fit into it.
+ * @param[out] len Number of characters, written to the target memory.
+ * @return Operation result, error::buffer_overflow if the text string is larger than the target memory.
+ */
+[[nodiscard]] CBOR_EXPORT std::error_code decode(read_buffer &buf, std::span<char> out, std::size_t &len);
+
 template <typename CharT,
           typename Traits,
           typename Allocator,
@@ -215,12 +302,13 @@ template <typename CharT,
       return error::buffer_overflow;
    }
 
-   v.resize(u64);
-
-   if (u64 != 0) {
-      return buf.read(buffer::span_t{reinterpret_cast<std::byte *>(v.data()), v.size()});
+   buffer::const_span_t bytes{};
+   res = detail::read_view(buf, u64, bytes);
+   if (res) {
+      return res;
    }
 
+   v.assign(reinterpret_cast<const CharT *>(bytes.data()), bytes.size());
    return error::success;
 }
 
@@ -291,7 +379,7 @@ bool try_decode(std::uint64_t type_id, read_buffer &buf, std::variant<All...> &v
    Current res;
    ec = decode(buf, res);
    if (!ec) {
-      v = res;
+      v = std::move(res);
    }
 
    // Always return false to signal that we finished decoding: we found a match for the Type ID
@@ -309,13 +397,97 @@ std::error_code try_decode_all(std::uint64_t type_id, read_buffer &buf, VariantT
    }
    return ec;
 }
+
+template <typename Current, typename Visitor>
+bool try_decode_visit(std::uint64_t type_id, read_buffer &buf, Visitor &visitor, std::error_code &ec) {
+   if (type_id_v<Current> != type_id) {
+      // Not the encoded type - return true to avoid short-circuiting and continue search
+      return true;
+   }
+
+   Current res;
+   ec = decode(buf, res);
+   if (ec) {
+      return false;
+   }
+
+   if constexpr (std::is_same_v<std::invoke_result_t<Visitor &, Current &>, std::error_code>) {
+      ec = visitor(res);
+   } else {
+      visitor(res);
+   }
+
+   return false;
+}
+
+template <typename Visitor, typename... T>
+std::error_code try_decode_visit_all(std::uint64_t type_id,
+                                     read_buffer &buf,
+                                     Visitor &visitor,
+                                     std::type_identity<std::variant<T...>>) {
+   std::error_code ec;
+   bool missing_type = ((try_decode_visit<T>(type_id, buf, visitor, ec)) && ...);
+   if (missing_type) {
+      // The encoded value is not in the variant's alternatives set
+      return error::unexpected_type;
+   }
+   return ec;
+}
+
+/**
+ * Decode the variant array header and the type ID (or the alternative tag), leaving the buffer at the alternative
+ * encoding.
+ */
+template <typename VariantT>
+std::error_code decode_variant_head(read_buffer &buf, std::int64_t &type_id) {
+   if constexpr (is_tagged_variant_v<VariantT>) {
+      detail::head head{};
+      auto res = head.read(buf);
+      if (res) {
+         return res;
+      }
+
+      if (head.type != major_type::tag) {
+         return error::unexpected_type;
+      }
+
+      const auto u64 = head.decode_argument();
+      if (u64 > max_int_v<std::int64_t>) {
+         return error::unexpected_type;
+      }
+
+      type_id = static_cast<std::int64_t>(u64);
+      return error::success;
+   }
+
+   std::byte head;
+   auto res = buf.read(head);
+   if (res) {
+      return res;
+   }
+
+   const auto array_byte = static_cast<std::byte>(major_type::array) | static_cast<std::byte>(2);
+   if (head != array_byte) {
+      return error::decoding_error;
+   }
+
+   return decode(buf, type_id);
+}
+
+template <typename T>
+struct is_variant : std::false_type {};
+
+template <typename... T>
+struct is_variant<std::variant<T...>> : std::true_type {};
+
 } // namespace detail
 
 /**
  * Decode a variant.
  *
  * Variants are encoded as an array of two elements, where the first one is a type identifier and the second one is
- * the encoding of an alternative.
+ * the encoding of an alternative. Variants marked with the is_tagged_variant trait are encoded as a tag with the type
+ * identifier as the tag number, followed by the encoding of an alternative.
  *
  * This function intentionally doesn't support primitive variant types. It is intended to be used with structs and
  * classes, because the primitive types:
@@ -332,29 +504,48 @@ template <typename... T>
 [[nodiscard]] std::error_code decode(read_buffer &buf, std::variant<T...> &v) {
    static_assert(detail::all_alternatives_are_unique<T...>(),
                  "TypeID duplicates are not allowed for variant alternatives");
-   // Decode the array header
-   std::byte head;
-   auto res = buf.read(head);
+   // Decode the array header and the type ID
+   std::int64_t type_id;
+   auto res = detail::decode_variant_head<std::variant<T...>>(buf, type_id);
    if (res) {
       return res;
    }
 
-   const auto array_byte = static_cast<std::byte>(major_type::array) | static_cast<std::byte>(2);
-   if (head != array_byte) {
-      return error::decoding_error;
-   }
+   // Use the type id to decode a currently active alternative
+   using type_idx_t = std::make_index_sequence<std::variant_size_v<std::remove_cvref_t<decltype(v)>>>;
+   res = detail::try_decode_all(type_id, buf, v, type_idx_t{});
+   return res;
+}
+
+/**
+ * Decode a variant alternative and pass it to a visitor, without constructing the variant itself.
+ *
+ * The encoding is the same as for decode(read_buffer &, std::variant<T...> &), but the matching alternative is decoded
+ * into a local value and handed to the visitor directly, saving the variant storage, a move and an std::visit call.
+ *
+ * @code{.cpp}
+ * auto res = cbor::decode_visit<request_t>(buf, [&](auto &r) { handle(r); });
+ * @endcode
+ *
+ * @tparam VariantT variant type, describing the set of expected alternatives.
+ * @param[in] buf Buffer to decode the value from.
+ * @param[in] visitor Callable, accepting a (non-const) reference to each alternative. Can either return nothing, or an
+ *                    std::error_code, which is then returned as the operation result.
+ * @return Operation result. The visitor is only called if the alternative was decoded successfully.
+ */
+template <typename VariantT, typename Visitor>
+   requires detail::is_variant<VariantT>::value
+[[nodiscard]] std::error_code decode_visit(read_buffer &buf, Visitor &&visitor) {
+   // Ensure the same constraints as for the variant decoding
+   static_assert(Decodable<VariantT>, "All variant alternatives should be decodable and have a type ID");
 
-   // Decode the type ID
    std::int64_t type_id;
-   res = decode(buf, type_id);
+   auto res = detail::decode_variant_head<VariantT>(buf, type_id);
    if (res) {
       return res;
    }
 
-   // Use the type id to decode a currently active alternative
-   using type_idx_t = std::make_index_sequence<std::variant_size_v<std::remove_cvref_t<decltype(v)>>>;
-   res = detail::try_decode_all(type_id, buf, v, type_idx_t{});
-   return res;
+   return detail::try_decode_visit_all(type_id, buf, visitor, std::type_identity<VariantT>{});
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -423,12 +614,282 @@ template <DecodableStruct T>
    return res;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Columnar Arrays
+////////////////////////////////////////////////////////////////////////////////
+namespace detail {
+
+//! Load a typed array element, stored in the little endian byte order
+template <TypedArrayElement T>
+T load_le(const std::byte *in) {
+   std::array<std::byte, sizeof(T)> bytes{};
+   std::memcpy(bytes.data(), in, sizeof(T));
+   if constexpr (std::endian::native == std::endian::big) {
+      std::ranges::reverse(bytes);
+   }
+   return std::bit_cast<T>(bytes);
+}
+
+/**
+ * Decode the head of a column (see encode_column_head).
+ *
+ * @tparam M Column element type.
+ * @param[in] buf Source buffer.
+ * @param[out] size Number of column elements.
+ * @return Operation result.
+ */
+template <typename M>
+[[nodiscard]] std::error_code decode_column_head(read_buffer &buf, std::uint64_t &size) {
+   head head{};
+   auto res = head.read(buf);
+   if (res) {
+      return res;
+   }
+
+   std::uint64_t min_bytes{};
+   if constexpr (TypedArrayElement<M>) {
+      if (head.type != major_type::tag || head.decode_argument() != typed_array_tag_v<M>) {
+         return error::unexpected_type;
+      }
+
+      res = head.read(buf);
+      if (res) {
+         return res;
+      }
+
+      if (head.type != major_type::byte_string) {
+         return error::unexpected_type;
+      }
+
+      min_bytes = head.decode_argument();
+      if (min_bytes % sizeof(M) != 0) {
+         return error::decoding_error;
+      }
+      size = min_bytes / sizeof(M);
+   } else {
+      if (head.type != major_type::array) {
+         return error::unexpected_type;
+      }
+
+      size = head.decode_argument();
+      min_bytes = size;
+   }
+
+   // Don't let the size allocate more than the input can hold
+   return check_remaining(buf, min_bytes);
+}
+
+/**
+ * Decode the elements of a column.
+ *
+ * @tparam M Column element type.
+ * @param[in] buf Source buffer.
+ * @param[in] size Number of column elements.
+ * @param[in] get Callable, returning a reference to the target element for an element index.
+ * @return Operation result.
+ */
+template <typename M, typename Getter>
+[[nodiscard]] std::error_code decode_column_values(read_buffer &buf, std::size_t size, Getter get) {
+   if constexpr (TypedArrayElement<M>) {
+      buffer::const_span_t bytes{};
+      auto res = read_view(buf, size * sizeof(M), bytes);
+      if (res) {
+         return res;
+      }
+
+      for (std::size_t i = 0; i < size; ++i) {
+         get(i) = load_le<M>(bytes.data() + i * sizeof(M));
+      }
+   } else {
+      for (std::size_t i = 0; i < size; ++i) {
+         auto res = decode(buf, get(i));
+         if (res) {
+            return res;
+         }
+      }
+   }
+
+   return error::success;
+}
+
+//! Decode the columns head: an array with one column per member
+template <typename T>
+[[nodiscard]] std::error_code decode_columns_head(read_buffer &buf) {
+   head head{};
+   auto res = head.read(buf);
+   if (res) {
+      return res;
+   }
+
+   if (head.type != major_type::array) {
+      return error::unexpected_type;
+   }
+
+   if (head.decode_argument() != get_member_count<T>()) {
+      return error::decoding_error;
+   }
+
+   return error::success;
+}
+
+/**
+ * Decode a vector of structs, encoded column by column (see is_columnar).
+ *
+ * The first column defines the number of elements, all the other columns have to be of the same size.
+ *
+ * @param[in] buf Source buffer.
+ * @param[out] v Decoded structs.
+ * @param[in] max_size Maximal number of elements.
+ * @return Operation result.
+ */
+template <DecodableStruct T, typename Allocator>
+[[nodiscard]] std::error_code decode_columnar(read_buffer &buf, std::vector<T, Allocator> &v, std::uint64_t max_size) {
+   auto res = decode_columns_head<T>(buf);
+   if (res) {
+      return res;
+   }
+
+   const auto decode_column = [&]<std::size_t Idx>(std::integral_constant<std::size_t, Idx>) {
+      using column_t = std::remove_cvref_t<decltype(get_member_non_const<Idx>(std::declval<T &>()))>;
+
+      std::uint64_t size{};
+      auto column_res = decode_column_head<column_t>(buf, size);
+      if (column_res) {
+         return column_res;
+      }
+
+      if constexpr (Idx == 0) {
+         if (size > max_size) {
+            return std::error_code{error::buffer_overflow};
+         }
+         v.resize(static_cast<std::size_t>(size));
+      } else {
+         if (size != v.size()) {
+            return std::error_code{error::decoding_error};
+         }
+      }
+
+      return decode_column_values<column_t>(buf, v.size(), [&v](std::size_t i) -> column_t & {
+         return get_member_non_const<Idx>(v[i]);
+      });
+   };
+
+   [&]<std::size_t... Ns>(std::index_sequence<Ns...>) {
+      ((res = decode_column(std::integral_constant<std::size_t, Ns>{}), !res) && ...);
+   }(std::make_index_sequence<get_member_count<T>()>{});
+
+   return res;
+}
+
+} // namespace detail
+
+//! Struct of arrays: a struct with a vector per member, that can hold the columnar encoding (see is_columnar)
+template <typename T>
+concept DecodableColumns = DecodableStruct<T> && detail::has_column_members<T, true>();
+
+/**
+ * Decode the columnar encoding into a struct of vectors.
+ *
+ * Accepts both the encoding of a columnar vector of structs (see is_columnar) with the matching member types, and the
+ * encoding produced by encode_columns(). All the decoded vectors are of the same size.
+ *
+ * @param[in] buf Buffer to decode the value from.
+ * @param[out] v Value to be decoded.
+ * @return Operation result.
+ */
+template <DecodableColumns T>
+[[nodiscard]] std::error_code decode_columns(read_buffer &buf, T &v) {
+   auto res = detail::decode_columns_head<T>(buf);
+   if (res) {
+      return res;
+   }
+
+   std::uint64_t expected_size{};
+   const auto decode_column = [&]<std::size_t Idx>(std::integral_constant<std::size_t, Idx>) {
+      auto &column = get_member_non_const<Idx>(v);
+      using column_t = value_type_t<decltype(column)>;
+
+      std::uint64_t size{};
+      auto column_res = detail::decode_column_head<column_t>(buf, size);
+      if (column_res) {
+         return column_res;
+      }
+
+      if constexpr (Idx == 0) {
+         expected_size = size;
+      } else {
+         if (size != expected_size) {
+            return std::error_code{error::decoding_error};
+         }
+      }
+
+      if (size > column.max_size()) {
+         return std::error_code{error::buffer_overflow};
+      }
+
+      if constexpr (TypedArrayElement<column_t> && std::endian::native == std::endian::little) {
+         // Already in the memory format
+         buffer::const_span_t bytes{};
+         column_res = detail::read_view(buf, size * sizeof(column_t), bytes);
+         if (column_res) {
+            return column_res;
+         }
+
+         column.resize(static_cast<std::size_t>(size));
+         std::memcpy(column.data(), bytes.data(), bytes.size());
+         return std::error_code{error::success};
+      } else {
+         column.resize(static_cast<std::size_t>(size));
+         return detail::decode_column_values<column_t>(buf, column.size(), [&column](std::size_t i) -> column_t & {
+            return column[i];
+         });
+      }
+   };
+
+   [&]<std::size_t... Ns>(std::index_sequence<Ns...>) {
+      ((res = decode_column(std::integral_constant<std::size_t, Ns>{}), !res) && ...);
+   }(std::make_index_sequence<get_member_count<T>()>{});
+
+   return res;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Arrays
 ////////////////////////////////////////////////////////////////////////////////
 template <typename T>
 concept DecodableNonByte = Decodable<T> && !IsByte<T>;
 
+namespace detail {
+
+/**
+ * Consume the elements of an unsigned integer array in bulk, if all of them are encoded in the initial byte.
+ *
+ * Small elements take a single byte each, so the next count bytes are checked with the vector kernel (see
+ * cpu_dispatch.h). Nothing is consumed if any of them is a larger value or a different data item.
+ *
+ * @param[in] buf Source buffer.
+ * @param[in] count Number of array elements.
+ * @param[out] v Element values, referencing the source buffer memory.
+ * @return true if the elements were consumed.
+ */
+[[nodiscard]] inline bool read_small_unsigned(read_buffer &buf, std::uint64_t count, std::span<const std::uint8_t> &v) {
+   const auto position = static_cast<std::size_t>(buf.read_position());
+   if (!buf.span().data() || count > buf.size() - position) {
+      return false;
+   }
+
+   const auto bytes = buf.span().subspan(position, static_cast<std::size_t>(count));
+   const std::span small{reinterpret_cast<const std::uint8_t *>(bytes.data()), bytes.size()};
+   if (cpu::max_value(small) > ZERO_EXTRA_BYTES_VALUE_LIMIT) {
+      return false;
+   }
+
+   v = small;
+   return !buf.skip(small.size());
+}
+
+} // namespace detail
+
 template <DecodableNonByte T, std::size_t Extent>
 [[nodiscard]] std::error_code decode(read_buffer &buf, std::span<T, Extent> v) {
    using span_t = std::span<T, Extent>;
@@ -458,6 +919,14 @@ template <DecodableNonByte T, std::size_t Extent>
       return error::success;
    }
 
+   if constexpr (detail::BulkUnsigned<T>) {
+      std::span<const std::uint8_t> small{};
+      if (detail::read_small_unsigned(buf, u64, small)) {
+         std::ranges::copy(small, v.begin());
+         return error::success;
+      }
+   }
+
    for (span_size_t i = 0; i < u64; ++i) {
       res = decode(buf, v[i]);
       if (res) {
@@ -469,11 +938,17 @@ template <DecodableNonByte T, std::size_t Extent>
 }
 
 template <DecodableNonByte T, typename Allocator, typename VectorT = std::vector<T, Allocator>>
+   requires(!IsBool<T>)
 [[nodiscard]] std::error_code decode(read_buffer &buf,
                                      std::vector<T, Allocator> &v,
                                                  max_size_t<VectorT> max_size = max_size_v<VectorT>) {
    static_assert(max_int_v<std::uint64_t> <= max_size_v<VectorT>);
 
+   if constexpr (is_columnar_v<T>) {
+      static_assert(DecodableStruct<T>, "Only structs can be decoded column by column");
+      return detail::decode_columnar(buf, v, max_size);
+   }
+
    detail::head head{};
    auto res = head.read(buf);
    if (res) {
@@ -489,6 +964,14 @@ template <DecodableNonByte T, typename Allocator, typename VectorT = std::vector
       return error::buffer_overflow;
    }
 
+   if constexpr (detail::BulkUnsigned<T>) {
+      std::span<const std::uint8_t> small{};
+      if (detail::read_small_unsigned(buf, u64, small)) {
+         v.assign(small.begin(), small.end());
+         return error::success;
+      }
+   }
+
    v.resize(u64);
 
    if (u64 == 0) {
@@ -505,7 +988,7 @@ template <DecodableNonByte T, typename Allocator, typename VectorT = std::vector
    return error::success;
 }
 
-template <Decodable T, std::size_t Extent>
+template <DecodableNonByte T, std::size_t Extent>
 [[nodiscard]] std::error_code decode(read_buffer &buf, std::array<T, Extent> &v) {
    using array_t = std::array<T, Extent>;
    using array_size_t = typename array_t::size_type;
@@ -513,6 +996,118 @@ template <Decodable T, std::size_t Extent>
    return decode(buf, std::span{v});
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Bit Vectors
+////////////////////////////////////////////////////////////////////////////////
+namespace detail {
+
+/**
+ * Decode the head of a packed bit vector (see detail::encode_bits).
+ *
+ * @param[in] buf Source buffer.
+ * @param[out] size Number of encoded bits.
+ * @param[out] packed Packed bits, referencing the source buffer memory.
+ * @return Operation result.
+ */
+[[nodiscard]] inline std::error_code decode_bits(read_buffer &buf, std::uint64_t &size, buffer::const_span_t &packed) {
+   head head{};
+   auto res = head.read(buf);
+   if (res) {
+      return res;
+   }
+
+   if (head.type != major_type::byte_string) {
+      return error::unexpected_type;
+   }
+
+   const auto u64 = head.decode_argument();
+   if (u64 == 0) {
+      return error::decoding_error;
+   }
+
+   std::byte unused_bits{};
+   res = buf.read(unused_bits);
+   if (res) {
+      return res;
+   }
+
+   const auto num_bytes = u64 - 1;
+   const auto unused = std::to_integer<std::uint8_t>(unused_bits);
+   if (unused > 7 || (num_bytes == 0 && unused != 0)) {
+      return error::decoding_error;
+   }
+
+   res = read_view(buf, num_bytes, packed);
+   if (res) {
+      return res;
+   }
+
+   size = num_bytes * 8 - unused;
+   return error::success;
+}
+
+inline bool unpack_bit(buffer::const_span_t packed, std::size_t idx) {
+   return ((std::to_integer<std::uint8_t>(packed[idx / 8]) >> (idx % 8)) & 1U) != 0;
+}
+
+} // namespace detail
+
+template <typename Allocator, typename VectorT = std::vector<bool, Allocator>>
+[[nodiscard]] std::error_code decode(read_buffer &buf,
+                                     std::vector<bool, Allocator> &v,
+                                     max_size_t<VectorT> max_size = max_size_v<VectorT>) {
+   std::uint64_t size{};
+   buffer::const_span_t packed{};
+   auto res = detail::decode_bits(buf, size, packed);
+   if (res) {
+      return res;
+   }
+
+   if (size > max_size) {
+      return error::buffer_overflow;
+   }
+
+   v.resize(size);
+   for (max_size_t<VectorT> i = 0; i < size; ++i) {
+      v[i] = detail::unpack_bit(packed, i);
+   }
+
+   return error::success;
+}
+
+template <std::size_t N>
+[[nodiscard]] std::error_code decode(read_buffer &buf, std::bitset<N> &v) {
+   std::uint64_t size{};
+   buffer::const_span_t packed{};
+   auto res = detail::decode_bits(buf, size, packed);
+   if (res) {
+      return res;
+   }
+
+   if (size > N) {
+      return error::buffer_overflow;
+   }
+
+   if (size < N) {
+      return error::buffer_underflow;
+   }
+
+   if constexpr (N <= 64) {
+      // Small bitsets are unpacked into a single word
+      std::uint64_t word = 0;
+      for (std::size_t i = 0; i < packed.size(); ++i) {
+         word |= static_cast<std::uint64_t>(std::to_integer<std::uint8_t>(packed[i])) << (i * 8);
+      }
+      v = std::bitset<N>{word};
+   } else {
+      for (std::size_t i = 0; i < N; ++i) {
+         v[i] = detail::unpack_bit(packed, i);
+      }
+   }
+
+   return error::success;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Dictionaries
 ////////////////////////////////////////////////////////////////////////////////
@@ -563,4 +1158,22 @@ template <DecodableDictionary T>
    return error::success;
 }
 
-} // namespace cbor
\ No newline at end of file
+////////////////////////////////////////////////////////////////////////////////
+/// Skipping
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Skip a single data item.
+ *
+ * Advances the read position past the next data item, including all of its nested items (array elements, dictionary
+ * pairs and tag contents), without decoding any values.
+ *
+ * @param[in] buf Buffer to skip the data item in.
+ * @return Operation result.
+ */
+[[nodiscard]] CBOR_EXPORT std::error_code skip(read_buffer &buf);
+
+} // namespace cbor
+
+#if CBOR_WITH(HEADER_ONLY_CODEC)
+#include <cbor/impl/decoding.h>
+#endif
@@ -0,0 +1,166 @@
+/**
+ * @file   encoded.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/decoding.h>
+#include <cbor/encoding.h>
+#include <cbor/error.h>
+
+#include <memory>
+#include <vector>
+
+namespace cbor {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: encoded
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Encoded value - holds the encoding of a single value of type T.
+ *
+ * Encoding an encoded value writes the held bytes verbatim, so a rarely changing part of a message can be encoded once
+ * and then spliced into any number of enclosing messages. The bytes are immutable and shared between copies, so copying
+ * an encoded value is cheap.
+ *
+ * Decoding into an encoded value captures the raw bytes of the next data item, without decoding it.
+ *
+ * @code{.cpp}
+ * struct response {
+ *    std::int64_t request_id;
+ *    cbor::encoded<phone_book> contacts;
+ * };
+ *
+ * cbor::encoded<phone_book> contacts{};
+ * if (auto res = contacts.assign(book)) { ... }
+ *
+ * // Only the request ID is encoded, the phone book is copied
+ * auto res = cbor::encode(buf, response{.request_id = id, .contacts = contacts});
+ * @endcode
+ */
+template <typename T>
+class encoded {
+public:
+   using value_type = T;
+
+public:
+   /**
+    * Encode a value.
+    * @param v Value to be encoded.
+    * @return Operation result.
+    */
+   [[nodiscard]] std::error_code assign(const T &v) {
+      auto bytes = std::make_shared<std::vector<std::byte>>();
+      dynamic_buffer buf{*bytes};
+
+      auto res = encode(buf, v);
+      if (res) {
+         return res;
+      }
+
+      bytes_ = std::move(bytes);
+      return error::success;
+   }
+
+   /**
+    * Take over an already encoded value.
+    *
+    * The bytes are validated once: they have to hold exactly one data item, decodable as T (if T is decodable).
+    *
+    * @param bytes Encoded value.
+    * @return Operation result.
+    */
+   [[nodiscard]] std::error_code assign_bytes(buffer::const_span_t bytes) {
+      read_buffer buf{bytes};
+
+      std::error_code res;
+      if constexpr (Decodable<T>) {
+         T tmp{};
+         res = decode(buf, tmp);
+      } else {
+         res = skip(buf);
+      }
+
+      if (res) {
+         return res;
+      }
+
+      if (static_cast<std::size_t>(buf.read_position()) != bytes.size()) {
+         return error::decoding_error;
+      }
+
+      bytes_ = std::make_shared<std::vector<std::byte>>(bytes.begin(), bytes.end());
+      return error::success;
+   }
+
+   /**
+    * Decode the held value.
+    * @param v Value to decode into.
+    * @return Operation result, invalid_usage if nothing is held.
+    */
+   template <typename U = T>
+      requires Decodable<U>
+   [[nodiscard]] std::error_code decode_value(U &v) const {
+      if (empty()) {
+         return error::invalid_usage;
+      }
+
+      read_buffer buf{bytes()};
+      return decode(buf, v);
+   }
+
+   void reset() { bytes_.reset(); }
+
+   [[nodiscard]] bool empty() const { return !bytes_; }
+
+   //! Encoded value (empty if nothing is held)
+   [[nodiscard]] buffer::const_span_t bytes() const {
+      return bytes_ ? buffer::const_span_t{*bytes_} : buffer::const_span_t{};
+   }
+
+private:
+   template <typename U>
+   friend std::error_code decode(read_buffer &buf, encoded<U> &v);
+
+   std::shared_ptr<const std::vector<std::byte>> bytes_{};
+};
+
+/**
+ * Encode an encoded value: the held bytes are written as is.
+ * @return Operation result, invalid_usage if nothing is held.
+ */
+template <typename T>
+[[nodiscard]] std::error_code encode(buffer &buf, const encoded<T> &v) {
+   if (v.empty()) {
+      return error::invalid_usage;
+   }
+
+   return buf.write(v.bytes());
+}
+
+/**
+ * Capture the next data item without decoding it.
+ *
+ * The data item is only checked for being well-formed (see skip()), not for being decodable as T.
+ */
+template <typename T>
+[[nodiscard]] std::error_code decode(read_buffer &buf, encoded<T> &v) {
+   auto rollback_helper = buf.get_rollback_helper();
+
+   const auto start = buf.read_position();
+   auto res = skip(buf);
+   if (res) {
+      return res;
+   }
+
+   const auto item = buf.span().subspan(start, buf.read_position() - start);
+   v.bytes_ = std::make_shared<std::vector<std::byte>>(item.begin(), item.end());
+
+   rollback_helper.commit();
+   return error::success;
+}
+
+} // namespace cbor
@@ -0,0 +1,193 @@
+/**
+ * @file   encoded_array.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/decoding.h>
+#include <cbor/encoding.h>
+#include <cbor/error.h>
+#include <cbor/type_traits.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace cbor {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: encoded_array
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Encoded array - append-only array, kept in the encoded form.
+ *
+ * The array head always uses a fixed-width count (see detail::encode_argument with compress = false), so appending an
+ * element only encodes that element and patches the count in place. The whole array is always available as a single
+ * byte span, ready to be sent or spliced into a message, without re-encoding.
+ *
+ * @code{.cpp}
+ * cbor::encoded_array<log_entry> log{};
+ * if (auto res = log.push_back(entry)) { ... }
+ *
+ * socket.send(log.bytes());
+ * @endcode
+ *
+ * @tparam T Element type.
+ * @tparam CountT Unsigned integer type, used for the element count in the array head.
+ */
+template <typename T, UnsignedInt CountT = std::uint32_t>
+class encoded_array {
+public:
+   using value_type = T;
+   using count_t = CountT;
+
+   inline static constexpr std::size_t head_size = 1 + sizeof(CountT);
+
+public:
+   encoded_array() { clear(); }
+
+public:
+   /**
+    * Encode and append an element.
+    * @param v Element to be appended.
+    * @return Operation result, value_not_representable if the count doesn't fit into CountT. The array is left
+    *         unchanged on failure.
+    */
+   [[nodiscard]] std::error_code push_back(const T &v) {
+      if (size_ == max_int_v<CountT>) {
+         return error::value_not_representable;
+      }
+
+      dynamic_buffer buf{bytes_};
+      auto res = encode(buf, v);
+      if (res) {
+         return res;
+      }
+
+      set_count(static_cast<CountT>(size_ + 1));
+      return error::success;
+   }
+
+   /**
+    * Append an already encoded element.
+    *
+    * The bytes have to hold exactly one well-formed data item.
+    *
+    * @param item Encoded element.
+    * @return Operation result.
+    */
+   [[nodiscard]] std::error_code push_back_encoded(buffer::const_span_t item) {
+      if (size_ == max_int_v<CountT>) {
+         return error::value_not_representable;
+      }
+
+      read_buffer buf{item};
+      auto res = skip(buf);
+      if (res) {
+         return res;
+      }
+
+      if (static_cast<std::size_t>(buf.read_position()) != item.size()) {
+         return error::decoding_error;
+      }
+
+      bytes_.insert(bytes_.end(), item.begin(), item.end());
+      set_count(static_cast<CountT>(size_ + 1));
+      return error::success;
+   }
+
+   //! Remove all elements
+   void clear() {
+      bytes_.resize(head_size);
+      set_count(0);
+   }
+
+   [[nodiscard]] std::size_t size() const { return static_cast<std::size_t>(size_); }
+   [[nodiscard]] bool empty() const { return size_ == 0; }
+
+   //! Encoded array, including the head
+   [[nodiscard]] buffer::const_span_t bytes() const { return bytes_; }
+
+   //! Encoded elements, without the head
+   [[nodiscard]] buffer::const_span_t elements() const { return buffer::const_span_t{bytes_}.subspan(head_size); }
+
+   //! Reserve memory for the specified number of encoded bytes
+   void reserve(std::size_t num_bytes) { bytes_.reserve(num_bytes); }
+
+private:
+   void set_count(CountT count) {
+      // Same as detail::encode_argument(buf, major_type::array, count, false)
+      constexpr auto size_bits = sizeof(CountT) == 1   ? argument_size::one_byte
+                                 : sizeof(CountT) == 2 ? argument_size::two_bytes
+                                 : sizeof(CountT) == 4 ? argument_size::four_bytes
+                                                       : argument_size::eight_bytes;
+
+      using namespace cbor::detail;
+      bytes_[0] = major_type::array | size_bits;
+      for (std::size_t i = 0; i < sizeof(CountT); ++i) {
+         const auto shift = (sizeof(CountT) - 1 - i) * 8U;
+         bytes_[i + 1] = static_cast<std::byte>((static_cast<std::uint64_t>(count) >> shift) & 0xFFU);
+      }
+
+      size_ = count;
+   }
+
+private:
+   template <typename U, UnsignedInt C>
+   friend std::error_code decode(read_buffer &buf, encoded_array<U, C> &v);
+
+   std::vector<std::byte> bytes_{};
+   CountT size_{0};
+};
+
+template <typename T, UnsignedInt CountT>
+[[nodiscard]] std::error_code encode(buffer &buf, const encoded_array<T, CountT> &v) {
+   return buf.write(v.bytes());
+}
+
+/**
+ * Decode an array, keeping it in the encoded form.
+ *
+ * The elements are only checked for being well-formed (see skip()), not for being decodable as T. The array head is
+ * re-encoded with a fixed-width count, so the decoded array can be appended to.
+ */
+template <typename T, UnsignedInt CountT>
+[[nodiscard]] std::error_code decode(read_buffer &buf, encoded_array<T, CountT> &v) {
+   auto rollback_helper = buf.get_rollback_helper();
+
+   detail::head head{};
+   auto res = head.read(buf);
+   if (res) {
+      return res;
+   }
+
+   if (head.type != major_type::array) {
+      return error::unexpected_type;
+   }
+
+   const auto count = head.decode_argument();
+   if (count > max_int_v<CountT>) {
+      return error::value_not_representable;
+   }
+
+   const auto start = buf.read_position();
+   for (std::uint64_t i = 0; i < count; ++i) {
+      res = skip(buf);
+      if (res) {
+         return res;
+      }
+   }
+
+   const auto items = buf.span().subspan(start, buf.read_position() - start);
+
+   v.clear();
+   v.bytes_.insert(v.bytes_.end(), items.begin(), items.end());
+   v.set_count(static_cast<CountT>(count));
+
+   rollback_helper.commit();
+   return error::success;
+}
+
+} // namespace cbor
@@ -7,18 +7,26 @@
 #pragma once
 
 #include <cbor/buffer.h>
+#include <cbor/cpu_dispatch.h>
 #include <cbor/error.h>
 #include <cbor/export.h>
 #include <cbor/type_traits.h>
 
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <bitset>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <optional>
+#include <span>
 #include <type_traits>
+#include <utility>
 #include <variant>
+#include <vector>
 
 namespace cbor {
 
@@ -168,19 +176,19 @@ inline constexpr uint64_t FOUR_EXTRA_BYTES_VALUE_LIMIT = 0xFFFFFFFFU;
                                                           std::uint64_t argument,
                                                           bool compress = true);
 
-inline std::byte operator|(major_type m, argument_size s) {
+inline constexpr std::byte operator|(major_type m, argument_size s) {
    const auto lhs = static_cast<std::byte>(m);
    const auto rhs = static_cast<std::byte>(s);
    return lhs | rhs;
 }
 
-inline std::byte operator|(major_type m, simple_type s) {
+inline constexpr std::byte operator|(major_type m, simple_type s) {
    const auto lhs = static_cast<std::byte>(m);
    const auto rhs = static_cast<std::byte>(s);
    return lhs | rhs;
 }
 
-inline std::byte operator|(std::byte b, std::uint8_t v) {
+inline constexpr std::byte operator|(std::byte b, std::uint8_t v) {
    return b | std::byte{v};
 }
 
@@ -313,6 +321,74 @@ consteval bool all_alternatives_are_unique() {
    return it == std::end(ids);
 }
 
+//! Pre-computed encoding of data item heads
+struct head_bytes {
+   //! Append a head, using the shortest argument encoding
+   constexpr void append(major_type type, std::uint64_t argument) {
+      std::size_t extra_bytes = 0;
+      if (argument <= ZERO_EXTRA_BYTES_VALUE_LIMIT) {
+         data[size++] = static_cast<std::byte>(type) | static_cast<std::uint8_t>(argument);
+      } else if (argument <= ONE_EXTRA_BYTE_VALUE_LIMIT) {
+         data[size++] = type | argument_size::one_byte;
+         extra_bytes = 1;
+      } else if (argument <= TWO_EXTRA_BYTES_VALUE_LIMIT) {
+         data[size++] = type | argument_size::two_bytes;
+         extra_bytes = 2;
+      } else if (argument <= FOUR_EXTRA_BYTES_VALUE_LIMIT) {
+         data[size++] = type | argument_size::four_bytes;
+         extra_bytes = 4;
+      } else {
+         data[size++] = type | argument_size::eight_bytes;
+         extra_bytes = 8;
+      }
+
+      // Arguments are encoded in big endian
+      for (std::size_t i = extra_bytes; i != 0; --i) {
+         data[size++] = static_cast<std::byte>((argument >> ((i - 1) * 8U)) & 0xFFU);
+      }
+   }
+
+   [[nodiscard]] constexpr buffer::const_span_t span() const { return {data.data(), size}; }
+
+   //! Up to two heads: an array head and a type ID
+   std::array<std::byte, 10> data{};
+   std::size_t size{0};
+};
+
+/**
+ * Encode everything preceding the alternative value: either the array head and the type ID, or the alternative tag.
+ */
+template <typename VariantT, typename Alternative>
+consteval head_bytes make_variant_prefix() {
+   constexpr auto id = type_id_v<Alternative>;
+
+   head_bytes result{};
+   if constexpr (is_tagged_variant_v<VariantT>) {
+      if constexpr (SignedInt<decltype(id)>) {
+         static_assert(id >= 0, "Tagged variant alternatives require non-negative type IDs");
+      }
+
+      result.append(major_type::tag, static_cast<std::uint64_t>(id));
+   } else {
+      result.append(major_type::array, 2U);
+
+      if constexpr (SignedInt<decltype(id)>) {
+         if (id < 0) {
+            result.append(major_type::signed_int, static_cast<std::uint64_t>(static_cast<std::int64_t>(-1) - id));
+            return result;
+         }
+      }
+
+      result.append(major_type::unsigned_int, static_cast<std::uint64_t>(id));
+   }
+
+   return result;
+}
+
+template <typename VariantT, typename Alternative>
+inline constexpr head_bytes variant_prefix_v =
+   make_variant_prefix<std::remove_cvref_t<VariantT>, std::remove_cvref_t<Alternative>>();
+
 } // namespace detail
 
 /**
@@ -320,6 +396,8 @@ consteval bool all_alternatives_are_unique() {
  *
  * Variants are encoded as an array of two elements, where the first one is a type identifier, specified via a type_id
  * template type specialization, and the second one is the encoding of the currently active alternative.
+ * Variants marked with the is_tagged_variant trait are encoded as a tag instead, with the type identifier as the tag
+ * number, followed by the encoding of the currently active alternative.
  *
  * This function intentionally doesn't support primitive variant types. It is intended to be used with structs and
  * classes, because the primitive types:
@@ -339,21 +417,19 @@ template <typename... T>
 
    auto rollback_helper = buf.get_rollback_helper();
 
-   // Start an array
-   auto res = encode_argument(buf, major_type::array, 2U);
-   if (res) {
-      return res;
-   }
-
-   // Encode the type identifier
-   const auto id = std::visit([](const auto &unwrapped) { return type_id_v<decltype(unwrapped)>; }, v);
-   res = encode(buf, id);
-   if (res) {
-      return res;
-   }
-
-   // Encode the value itself
-   res = std::visit([&buf](const auto &unwrapped) { return encode(buf, unwrapped); }, v);
+   auto res = std::visit(
+      [&buf](const auto &unwrapped) {
+         // The array head with the type identifier (or the tag) only depends on the alternative type
+         constexpr const auto &prefix = detail::variant_prefix_v<std::variant<T...>, decltype(unwrapped)>;
+         auto res = buf.write(prefix.span());
+         if (res) {
+            return res;
+         }
+
+         // Encode the value itself
+         return encode(buf, unwrapped);
+      },
+      v);
    if (res) {
       return res;
    }
@@ -421,11 +497,272 @@ template <EncodableStruct T>
    return res;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Columnar Arrays
+////////////////////////////////////////////////////////////////////////////////
+namespace detail {
+
+//! Number of typed array bytes written to the buffer at once
+inline constexpr std::size_t COLUMN_CHUNK_SIZE = 256;
+
+//! RFC 8746 typed array tag: 0b010_f_s_e_ll, with the little endian flag (e) set for the multi-byte elements
+template <TypedArrayElement T>
+inline constexpr std::uint64_t typed_array_tag_v = [] {
+   constexpr std::uint64_t little_endian = sizeof(T) > 1 ? 0x04 : 0x00;
+   if constexpr (std::is_floating_point_v<T>) {
+      // Floats start at 16 bits: ll = 1 for single and ll = 2 for double precision
+      return 0x40 | 0x10 | little_endian | static_cast<std::uint64_t>(std::bit_width(sizeof(T)) - 2);
+   } else {
+      constexpr std::uint64_t sign = std::is_signed_v<T> ? 0x08 : 0x00;
+      return 0x40 | sign | little_endian | static_cast<std::uint64_t>(std::bit_width(sizeof(T)) - 1);
+   }
+}();
+
+//! Store a typed array element in the little endian byte order
+template <TypedArrayElement T>
+void store_le(T v, std::byte *out) {
+   auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(v);
+   if constexpr (std::endian::native == std::endian::big) {
+      std::ranges::reverse(bytes);
+   }
+   std::memcpy(out, bytes.data(), sizeof(T));
+}
+
+/**
+ * Encode the head of a column: the typed array tag and the byte string head for integers and floats, or the array head
+ * for everything else.
+ *
+ * @tparam M Column element type.
+ * @param buf Target buffer.
+ * @param size Number of column elements.
+ * @return Operation result.
+ */
+template <typename M>
+[[nodiscard]] std::error_code encode_column_head(buffer &buf, std::size_t size) {
+   if constexpr (TypedArrayElement<M>) {
+      auto res = encode_argument(buf, major_type::tag, typed_array_tag_v<M>);
+      if (res) {
+         return res;
+      }
+
+      return encode_argument(buf, major_type::byte_string, static_cast<std::uint64_t>(size * sizeof(M)));
+   } else {
+      return encode_argument(buf, major_type::array, static_cast<std::uint64_t>(size));
+   }
+}
+
+/**
+ * Encode the elements of a column.
+ *
+ * @tparam M Column element type.
+ * @param buf Target buffer.
+ * @param size Number of column elements.
+ * @param get Callable, returning the column element for an element index.
+ * @return Operation result.
+ */
+template <typename M, typename Getter>
+[[nodiscard]] std::error_code encode_column_values(buffer &buf, std::size_t size, Getter get) {
+   if constexpr (TypedArrayElement<M>) {
+      std::array<std::byte, COLUMN_CHUNK_SIZE - COLUMN_CHUNK_SIZE % sizeof(M)> chunk{};
+      std::size_t used = 0;
+
+      for (std::size_t i = 0; i < size; ++i) {
+         store_le<M>(get(i), chunk.data() + used);
+         used += sizeof(M);
+         if (used == chunk.size()) {
+            auto res = buf.write(buffer::const_span_t{chunk});
+            if (res) {
+               return res;
+            }
+            used = 0;
+         }
+      }
+
+      if (used != 0) {
+         return buf.write(buffer::const_span_t{chunk.data(), used});
+      }
+   } else {
+      for (std::size_t i = 0; i < size; ++i) {
+         auto res = encode(buf, get(i));
+         if (res) {
+            return res;
+         }
+      }
+   }
+
+   return error::success;
+}
+
+template <std::size_t Idx, typename T>
+[[nodiscard]] std::error_code encode_row_column(buffer &buf, std::span<const T> rows) {
+   using column_t = member_type_t<T, Idx>;
+
+   auto res = encode_column_head<column_t>(buf, rows.size());
+   if (res) {
+      return res;
+   }
+
+   return encode_column_values<column_t>(buf, rows.size(),
+                                         [rows](std::size_t i) -> const column_t & { return get_member<Idx>(rows[i]); });
+}
+
+/**
+ * Encode a sequence of structs column by column (see is_columnar).
+ *
+ * @param buf Target buffer.
+ * @param rows Structs to be encoded.
+ * @return Operation result.
+ */
+template <EncodableStruct T>
+[[nodiscard]] std::error_code encode_columnar(buffer &buf, std::span<const T> rows) {
+   auto rollback_helper = buf.get_rollback_helper();
+
+   auto res = encode_argument(buf, major_type::array, get_member_count<T>());
+   if (res) {
+      return res;
+   }
+
+   [&]<std::size_t... Ns>(std::index_sequence<Ns...>) {
+      ((res = encode_row_column<Ns>(buf, rows), !res) && ...);
+   }(std::make_index_sequence<get_member_count<T>()>{});
+   if (res) {
+      return res;
+   }
+
+   rollback_helper.commit();
+
+   return res;
+}
+
+template <typename T>
+concept ColumnVector = std::is_same_v<T, std::vector<value_type_t<T>, typename T::allocator_type>> &&
+                       !IsBool<value_type_t<T>>;
+
+//! Check whether all the struct members are vectors, with either the const or the non-const member access
+template <typename T, bool NonConst>
+consteval bool has_column_members() {
+   return []<std::size_t... Ns>(std::index_sequence<Ns...>) {
+      if constexpr (NonConst) {
+         return (ColumnVector<std::remove_cvref_t<decltype(get_member_non_const<Ns>(std::declval<T &>()))>> && ...);
+      } else {
+         return (ColumnVector<std::remove_cvref_t<decltype(get_member<Ns>(std::declval<const T &>()))>> && ...);
+      }
+   }(std::make_index_sequence<get_member_count<T>()>{});
+}
+
+} // namespace detail
+
+//! Struct of arrays: a struct with a vector per member, that can hold the columnar encoding (see is_columnar)
+template <typename T>
+concept EncodableColumns = EncodableStruct<T> && detail::has_column_members<T, false>();
+
+/**
+ * Encode a struct of vectors in the columnar format.
+ *
+ * The encoding is the same as of a columnar vector of structs (see is_columnar) with the matching member types, so
+ * the column-wise data can be sent without transposing it into rows first. All the vectors have to be of the same
+ * size.
+ *
+ * @param buf Buffer to encode the value into.
+ * @param v Value to be encoded.
+ * @return Operation result.
+ */
+template <EncodableColumns T>
+[[nodiscard]] std::error_code encode_columns(buffer &buf, const T &v) {
+   const auto size = get_member<0>(v).size();
+   const bool same_sizes = [&]<std::size_t... Ns>(std::index_sequence<Ns...>) {
+      return ((get_member<Ns>(v).size() == size) && ...);
+   }(std::make_index_sequence<get_member_count<T>()>{});
+   if (!same_sizes) {
+      return error::invalid_usage;
+   }
+
+   auto rollback_helper = buf.get_rollback_helper();
+
+   auto res = encode_argument(buf, major_type::array, get_member_count<T>());
+   if (res) {
+      return res;
+   }
+
+   const auto encode_column = [&]<std::size_t Idx>(std::integral_constant<std::size_t, Idx>) {
+      const auto &column = get_member<Idx>(v);
+      using column_t = value_type_t<decltype(column)>;
+
+      auto column_res = detail::encode_column_head<column_t>(buf, size);
+      if (column_res) {
+         return column_res;
+      }
+
+      if constexpr (TypedArrayElement<column_t> && std::endian::native == std::endian::little) {
+         // Already in the wire format
+         return buf.write(std::as_bytes(std::span{column}));
+      } else {
+         return detail::encode_column_values<column_t>(buf, size, [&](std::size_t i) -> const column_t & {
+            return column[i];
+         });
+      }
+   };
+
+   [&]<std::size_t... Ns>(std::index_sequence<Ns...>) {
+      ((res = encode_column(std::integral_constant<std::size_t, Ns>{}), !res) && ...);
+   }(std::make_index_sequence<get_member_count<T>()>{});
+   if (res) {
+      return res;
+   }
+
+   rollback_helper.commit();
+
+   return res;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Arrays
 ////////////////////////////////////////////////////////////////////////////////
+namespace detail {
+
+//! Unsigned integer types, whose contiguous arrays are scanned with the vector kernels (see cpu_dispatch.h)
+template <typename T>
+concept BulkUnsigned = !IsByte<T> && (std::same_as<T, std::uint8_t> || std::same_as<T, std::uint16_t> ||
+                                      std::same_as<T, std::uint32_t> || std::same_as<T, std::uint64_t>);
+
+//! Number of small integers written to the buffer at once
+inline constexpr std::size_t SMALL_UNSIGNED_CHUNK_SIZE = 64;
+
+/**
+ * Encode the elements of an unsigned integer array, that are all small enough to fit into the initial byte.
+ *
+ * @param buf Target buffer.
+ * @param v Array elements, none of them greater than ZERO_EXTRA_BYTES_VALUE_LIMIT.
+ * @return Operation result.
+ */
+template <BulkUnsigned T>
+[[nodiscard]] std::error_code encode_small_unsigned(buffer &buf, std::span<const T> v) {
+   std::array<std::byte, SMALL_UNSIGNED_CHUNK_SIZE> chunk{};
+   for (std::size_t i = 0; i < v.size(); i += chunk.size()) {
+      const auto count = std::min(chunk.size(), v.size() - i);
+      // The major type of unsigned integers is zero, so the encoded byte is the value itself
+      std::transform(v.begin() + i, v.begin() + i + count, chunk.begin(),
+                     [](T e) { return std::byte{static_cast<std::uint8_t>(e)}; });
+
+      auto res = buf.write(buffer::const_span_t{chunk.data(), count});
+      if (res) {
+         return res;
+      }
+   }
+
+   return error::success;
+}
+
+} // namespace detail
+
+template <IsByte T, std::size_t Extent>
+[[nodiscard]] std::error_code encode(buffer &buf, std::span<const T, Extent> v) {
+   static_assert(sizeof(T) == sizeof(std::byte));
+   return encode(buf, buffer::const_span_t{reinterpret_cast<const std::byte *>(v.data()), v.size()});
+}
+
 template <typename T, std::size_t Extent>
-   requires Encodable<T>
+   requires Encodable<T> && (!IsByte<T>)
 [[nodiscard]] std::error_code encode(buffer &buf, std::span<const T, Extent> v) {
    auto rollback_helper = buf.get_rollback_helper();
 
@@ -435,6 +772,18 @@ template <typename T, std::size_t Extent>
       return res;
    }
 
+   if constexpr (detail::BulkUnsigned<T>) {
+      // Arrays of small values take a single byte per element, so they can be encoded in bulk, once the vector kernel
+      // confirmed that none of the elements needs extra bytes
+      if (cpu::max_value(std::span<const T>{v}) <= detail::ZERO_EXTRA_BYTES_VALUE_LIMIT) {
+         res = detail::encode_small_unsigned(buf, std::span<const T>{v});
+         if (!res) {
+            rollback_helper.commit();
+         }
+         return res;
+      }
+   }
+
    for (const auto &e : v) {
       res = encode(buf, e);
       if (res) {
@@ -456,7 +805,107 @@ template <typename T, std::size_t Extent>
 template <typename T, typename Allocator>
    requires Encodable<T>
 [[nodiscard]] std::error_code encode(buffer &buf, const std::vector<T, Allocator> &v) {
-   return encode(buf, std::span{v});
+   if constexpr (is_columnar_v<T>) {
+      static_assert(EncodableStruct<T>, "Only structs can be encoded column by column");
+      return detail::encode_columnar(buf, std::span<const T>{v});
+   } else {
+      return encode(buf, std::span{v});
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Bit Vectors
+////////////////////////////////////////////////////////////////////////////////
+namespace detail {
+
+//! Number of packed bytes written to the buffer at once
+inline constexpr std::size_t BIT_VECTOR_CHUNK_SIZE = 64;
+
+/**
+ * Encode a sequence of bits as a byte string.
+ *
+ * The first byte of the string holds the number of unused (zero) bits in the last byte, the remaining bytes hold the
+ * bits, packed LSB-first: bit i is stored in byte i / 8, at the position i % 8.
+ *
+ * @param buf Target buffer.
+ * @param size Number of bits.
+ * @param get_byte Callable, returning the packed byte for a byte index.
+ * @return Operation result.
+ */
+template <typename ByteGetter>
+[[nodiscard]] std::error_code encode_bits(buffer &buf, std::size_t size, ByteGetter get_byte) {
+   auto rollback_helper = buf.get_rollback_helper();
+
+   const auto num_bytes = (size + 7) / 8;
+   const auto unused_bits = static_cast<std::uint8_t>(num_bytes * 8 - size);
+
+   auto res = encode_argument(buf, major_type::byte_string, static_cast<std::uint64_t>(num_bytes + 1));
+   if (res) {
+      return res;
+   }
+
+   std::array<std::byte, BIT_VECTOR_CHUNK_SIZE> chunk{};
+   chunk[0] = std::byte{unused_bits};
+   std::size_t used = 1;
+
+   for (std::size_t i = 0; i < num_bytes; ++i) {
+      chunk[used++] = std::byte{get_byte(i)};
+      if (used == chunk.size()) {
+         res = buf.write(buffer::const_span_t{chunk});
+         if (res) {
+            return res;
+         }
+         used = 0;
+      }
+   }
+
+   if (used != 0) {
+      res = buf.write(buffer::const_span_t{chunk.data(), used});
+      if (res) {
+         return res;
+      }
+   }
+
+   rollback_helper.commit();
+
+   return res;
+}
+
+//! Pack up to 8 bits, starting at the specified bit index
+template <typename Container>
+std::uint8_t pack_byte(const Container &v, std::size_t size, std::size_t byte_idx) {
+   const auto first = byte_idx * 8;
+   const auto count = std::min<std::size_t>(size - first, 8);
+
+   std::uint8_t packed = 0;
+   for (std::size_t j = 0; j < count; ++j) {
+      packed |= static_cast<std::uint8_t>(static_cast<std::uint8_t>(v[first + j]) << j);
+   }
+   return packed;
+}
+
+} // namespace detail
+
+/**
+ * Encode a vector of booleans as a packed bit vector (see detail::encode_bits), using one bit per value.
+ */
+template <typename Allocator>
+[[nodiscard]] std::error_code encode(buffer &buf, const std::vector<bool, Allocator> &v) {
+   return detail::encode_bits(buf, v.size(), [&v](std::size_t i) { return detail::pack_byte(v, v.size(), i); });
+}
+
+/**
+ * Encode a bitset as a packed bit vector (see detail::encode_bits), using one bit per value.
+ */
+template <std::size_t N>
+[[nodiscard]] std::error_code encode(buffer &buf, const std::bitset<N> &v) {
+   if constexpr (N <= 64) {
+      // Small bitsets are packed from a single word
+      const auto word = static_cast<std::uint64_t>(v.to_ullong());
+      return detail::encode_bits(buf, N, [word](std::size_t i) { return static_cast<std::uint8_t>(word >> (i * 8)); });
+   } else {
+      return detail::encode_bits(buf, N, [&v](std::size_t i) { return detail::pack_byte(v, N, i); });
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -494,4 +943,8 @@ template <EncodableDictionary T>
    return res;
 }
 
-} // namespace cbor
\ No newline at end of file
+} // namespace cbor
+
+#if CBOR_WITH(HEADER_ONLY_CODEC)
+#include <cbor/impl/encoding.h>
+#endif
@@ -39,6 +39,9 @@ enum class error {
 
    //! The encoded byte-sequence is ill-formed
    ill_formed,
+
+   //! The requested data item is not present
+   not_found,
 };
 
 const std::error_category &cbor_category() noexcept CBOR_EXPORT;
@@ -0,0 +1,315 @@
+/**
+ * @file   event_parser.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/decoding.h>
+#include <cbor/error.h>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+namespace cbor {
+
+//! Default maximal nesting depth of arrays and dictionaries, supported by the event parser
+inline constexpr std::size_t default_max_parse_depth = 64;
+
+namespace detail {
+
+/**
+ * Invoke a handler callback, the callbacks can either return nothing, or an error code, to stop the parsing.
+ */
+template <typename F>
+std::error_code emit(F &&f) {
+   if constexpr (std::is_same_v<std::invoke_result_t<F>, std::error_code>) {
+      return f();
+   } else {
+      f();
+      return error::success;
+   }
+}
+
+struct parse_frame {
+   //! Number of items left in the container (dictionaries count both the keys and the values)
+   std::uint64_t remaining;
+
+   //! Container type: either an array or a dictionary
+   major_type type;
+};
+
+} // namespace detail
+
+/**
+ * Parse a single data item, including all of its nested items, and report it to a handler as a sequence of events.
+ *
+ * The handler type is known at compile time, so all the callbacks can be inlined, and the parser itself doesn't
+ * allocate any memory: strings and byte strings are passed as views into the read buffer.
+ *
+ * All the callbacks are optional, events without a matching callback are silently dropped:
+ * - on_uint(std::uint64_t)
+ * - on_int(std::int64_t) - negative integers
+ * - on_bytes(std::span<const std::byte>)
+ * - on_string(std::string_view)
+ * - on_array_begin(std::uint64_t size), on_array_end()
+ * - on_map_begin(std::uint64_t size), on_map_end() - keys and values are reported as alternating items
+ * - on_tag(std::uint64_t) - followed by the tagged item
+ * - on_bool(bool), on_null(), on_undefined()
+ * - on_float(double) - half, single and double precision floats
+ * - on_simple(std::uint8_t) - unassigned simple values
+ *
+ * Callbacks may return an std::error_code: a non-zero value stops the parsing and is returned as the result.
+ *
+ * @code{.cpp}
+ * struct counter {
+ *    void on_string(std::string_view s) { total += s.size(); }
+ *    std::size_t total{0};
+ * };
+ *
+ * counter c{};
+ * auto res = cbor::parse(buf, c);
+ * @endcode
+ *
+ * @tparam MaxDepth Maximal supported nesting depth, deeper items result in a decoding_error.
+ * @param buf Buffer to parse the data item from. The read position is left at the failure point on errors.
+ * @param handler Event handler.
+ * @return Operation result.
+ */
+template <std::size_t MaxDepth = default_max_parse_depth, typename Handler>
+[[nodiscard]] std::error_code parse(read_buffer &buf, Handler &handler) {
+   using namespace cbor::detail;
+
+   std::array<parse_frame, MaxDepth> stack{};
+   std::size_t depth = 0;
+
+   std::error_code res{};
+
+   for (;;) {
+      const auto head_position = buf.read_position();
+
+      head head{};
+      res = head.read(buf);
+      if (res) {
+         return res;
+      }
+
+      const bool indefinite = head.is_indefinite();
+      const auto argument = head.decode_argument();
+
+      // Set for the containers with at least one item, and for tags: the data item continues with the next head
+      bool nested = false;
+
+      switch (head.type) {
+         case major_type::unsigned_int:
+            if (indefinite) {
+               return error::ill_formed;
+            }
+
+            if constexpr (requires { handler.on_uint(argument); }) {
+               res = emit([&] { return handler.on_uint(argument); });
+            }
+            break;
+
+         case major_type::signed_int: {
+            if (indefinite) {
+               return error::ill_formed;
+            }
+
+            if (argument > max_int_v<std::int64_t>) {
+               return error::value_not_representable;
+            }
+
+            const std::int64_t n = static_cast<std::int64_t>(-1) - static_cast<std::int64_t>(argument);
+            if constexpr (requires { handler.on_int(n); }) {
+               res = emit([&] { return handler.on_int(n); });
+            }
+            break;
+         }
+
+         case major_type::byte_string:
+         case major_type::text_string: {
+            if (indefinite) {
+               // Indefinite-length items are not supported by this library
+               return error::decoding_error;
+            }
+
+            const auto start = static_cast<std::size_t>(buf.read_position());
+            res = buf.skip(argument);
+            if (res) {
+               return res;
+            }
+
+            const auto bytes = buf.span().subspan(start, argument);
+            if (head.type == major_type::byte_string) {
+               if constexpr (requires { handler.on_bytes(bytes); }) {
+                  res = emit([&] { return handler.on_bytes(bytes); });
+               }
+            } else {
+               const std::string_view str{reinterpret_cast<const char *>(bytes.data()), bytes.size()};
+               if constexpr (requires { handler.on_string(str); }) {
+                  res = emit([&] { return handler.on_string(str); });
+               }
+            }
+            break;
+         }
+
+         case major_type::array:
+         case major_type::dictionary: {
+            if (indefinite) {
+               // Indefinite-length items are not supported by this library
+               return error::decoding_error;
+            }
+
+            const bool is_array = head.type == major_type::array;
+            res = check_remaining(buf, argument, is_array ? 1 : 2);
+            if (res) {
+               return res;
+            }
+
+            if (is_array) {
+               if constexpr (requires { handler.on_array_begin(argument); }) {
+                  res = emit([&] { return handler.on_array_begin(argument); });
+               }
+            } else {
+               if constexpr (requires { handler.on_map_begin(argument); }) {
+                  res = emit([&] { return handler.on_map_begin(argument); });
+               }
+            }
+
+            if (res) {
+               return res;
+            }
+
+            if (argument != 0) {
+               if (depth == MaxDepth) {
+                  // Nested too deep for the parser's stack
+                  return error::decoding_error;
+               }
+
+               stack[depth++] = {is_array ? argument : argument * 2, head.type};
+               nested = true;
+            } else if (is_array) {
+               if constexpr (requires { handler.on_array_end(); }) {
+                  res = emit([&] { return handler.on_array_end(); });
+               }
+            } else {
+               if constexpr (requires { handler.on_map_end(); }) {
+                  res = emit([&] { return handler.on_map_end(); });
+               }
+            }
+            break;
+         }
+
+         case major_type::tag:
+            if (indefinite) {
+               return error::ill_formed;
+            }
+
+            if constexpr (requires { handler.on_tag(argument); }) {
+               res = emit([&] { return handler.on_tag(argument); });
+            }
+
+            // The tag content follows the head
+            nested = true;
+            break;
+
+         case major_type::simple:
+            switch (head.simple) {
+               case simple_type::false_type:
+               case simple_type::true_type: {
+                  const bool v = head.simple == simple_type::true_type;
+                  if constexpr (requires { handler.on_bool(v); }) {
+                     res = emit([&] { return handler.on_bool(v); });
+                  }
+                  break;
+               }
+
+               case simple_type::null_type:
+                  if constexpr (requires { handler.on_null(); }) {
+                     res = emit([&] { return handler.on_null(); });
+                  }
+                  break;
+
+               case simple_type::undefined_type:
+                  if constexpr (requires { handler.on_undefined(); }) {
+                     res = emit([&] { return handler.on_undefined(); });
+                  }
+                  break;
+
+               case simple_type::hp_float:
+               case simple_type::sp_float:
+               case simple_type::dp_float: {
+                  // Re-read the item with the regular float decoding, so that all float widths are handled the same
+                  buf.reset(head_position);
+
+                  double v{};
+                  res = decode(buf, v);
+                  if (res) {
+                     return res;
+                  }
+
+                  if constexpr (requires { handler.on_float(v); }) {
+                     res = emit([&] { return handler.on_float(v); });
+                  }
+                  break;
+               }
+
+               case simple_type::break_type:
+                  // "break" stop code outside an indefinite-length item
+                  return error::ill_formed;
+
+               default: {
+                  const auto v = static_cast<std::uint8_t>(argument);
+                  if constexpr (requires { handler.on_simple(v); }) {
+                     res = emit([&] { return handler.on_simple(v); });
+                  }
+                  break;
+               }
+            }
+            break;
+      }
+
+      if (res) {
+         return res;
+      }
+
+      if (nested) {
+         continue;
+      }
+
+      // A data item is complete: close all the containers it was the last item of
+      while (depth != 0) {
+         auto &top = stack[depth - 1];
+         if (--top.remaining != 0) {
+            break;
+         }
+
+         --depth;
+         if (top.type == major_type::array) {
+            if constexpr (requires { handler.on_array_end(); }) {
+               res = emit([&] { return handler.on_array_end(); });
+            }
+         } else {
+            if constexpr (requires { handler.on_map_end(); }) {
+               res = emit([&] { return handler.on_map_end(); });
+            }
+         }
+
+         if (res) {
+            return res;
+         }
+      }
+
+      if (depth == 0) {
+         return error::success;
+      }
+   }
+}
+
+} // namespace cbor
@@ -0,0 +1,221 @@
+/**
+ * @file   field_update.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/encoding.h>
+#include <cbor/error.h>
+#include <cbor/export.h>
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace cbor {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: path_element
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Path element - a single step into a nested data item: either an array index, or a map key.
+ *
+ * Integers are treated as array indices (structs are encoded as arrays, so struct members are addressed by their index),
+ * strings are treated as text map keys. Integer map keys have to be specified explicitly, see int_key().
+ *
+ * @code{.cpp}
+ * // Third member of the struct, stored under the "routing" key
+ * const cbor::path_element path[] = {"routing", 2};
+ * @endcode
+ */
+class CBOR_EXPORT path_element final {
+public:
+   enum class kind : std::uint8_t {
+      index,
+      text_key,
+      int_key,
+   };
+
+public:
+   template <std::integral T>
+   path_element(T index)
+      : kind_{kind::index}
+      , index_{static_cast<std::uint64_t>(index)} {
+      // Nothing to do here
+   }
+
+   path_element(std::string_view key)
+      : kind_{kind::text_key}
+      , text_key_{key} {
+      // Nothing to do here
+   }
+
+   path_element(const char *key)
+      : path_element(std::string_view{key}) {
+      // Nothing to do here
+   }
+
+public:
+   //! Integer map key
+   [[nodiscard]] static path_element int_key(std::int64_t key);
+
+public:
+   [[nodiscard]] kind get_kind() const { return kind_; }
+
+   [[nodiscard]] std::uint64_t index() const { return index_; }
+   [[nodiscard]] std::string_view text_key() const { return text_key_; }
+   [[nodiscard]] std::int64_t int_key() const { return int_key_; }
+
+private:
+   path_element() = default;
+
+private:
+   kind kind_{kind::index};
+   std::uint64_t index_{0};
+   std::string_view text_key_{};
+   std::int64_t int_key_{0};
+};
+
+using path_t = std::span<const path_element>;
+
+//! Position of a data item inside an encoded buffer
+struct field_location {
+   //!< Offset of the data item's head
+   std::size_t offset;
+
+   //!< Total size of the data item, including the head and all the nested items
+   std::size_t size;
+};
+
+/**
+ * Find a nested data item, without decoding anything but the heads and the map keys along the path.
+ *
+ * Tags in front of the containers along the path are skipped.
+ *
+ * @param data Encoded data item.
+ * @param path Path to the nested data item (an empty path refers to the data item itself).
+ * @param[out] location Location of the nested data item.
+ * @return Operation result, not_found if there is no such index or key.
+ */
+[[nodiscard]] CBOR_EXPORT std::error_code locate(buffer::const_span_t data, path_t path, field_location &location);
+
+namespace detail {
+
+/**
+ * Overwrite the encoded data item at the specified location with a different one, without changing the buffer size.
+ *
+ * Besides the case of both data items having the same size, the replacement is also performed when the existing data
+ * item has a wider head than required by the new one (e.g. an u32 field, holding a value that became small). In that
+ * case the new data item keeps the existing head width.
+ *
+ * @return Operation result, value_not_representable if the new data item doesn't fit.
+ */
+[[nodiscard]] CBOR_EXPORT std::error_code overwrite(buffer::span_t data,
+                                                    const field_location &location,
+                                                    buffer::const_span_t item);
+
+//! Same as overwrite(), but falls back to replacing the data item's bytes, if the new one doesn't fit.
+[[nodiscard]] CBOR_EXPORT std::error_code splice(std::vector<std::byte> &data,
+                                                 const field_location &location,
+                                                 buffer::const_span_t item);
+
+//! Small values are encoded on the stack, everything else - on the heap
+template <typename T>
+inline constexpr bool is_small_field_v = Int<T> || Enum<T> || IsBool<T>;
+
+template <typename T, typename Func>
+[[nodiscard]] std::error_code with_encoded_field(const T &v, Func &&func) {
+   if constexpr (is_small_field_v<T>) {
+      std::array<std::byte, 9> storage{};
+      static_buffer buf{storage};
+      auto res = encode(buf, v);
+      if (res) {
+         return res;
+      }
+      return func(buffer::const_span_t{storage}.first(buf.size()));
+   } else {
+      std::vector<std::byte> storage{};
+      dynamic_buffer buf{storage};
+      auto res = encode(buf, v);
+      if (res) {
+         return res;
+      }
+      return func(buffer::const_span_t{storage});
+   }
+}
+
+} // namespace detail
+
+/**
+ * Replace a nested data item in place, without touching the rest of the buffer.
+ *
+ * The new value has to fit into the space occupied by the existing data item (see detail::overwrite()). This is
+ * always the case for integers that fit into the existing head width, e.g. when updating a fixed-width field of a
+ * message template.
+ *
+ * @code{.cpp}
+ * // Decrement the hop count of a forwarded message
+ * const cbor::path_element path[] = {"header", 3};
+ * if (auto res = cbor::update_in_place(message, path, hops - 1)) { ... }
+ * @endcode
+ *
+ * @param data Encoded data item.
+ * @param path Path to the nested data item to be replaced.
+ * @param v New value.
+ * @return Operation result, value_not_representable if the new value doesn't fit. The data is left unchanged on
+ *         failure.
+ */
+template <typename T>
+[[nodiscard]] std::error_code update_in_place(buffer::span_t data, path_t path, const T &v) {
+   field_location location{};
+   auto res = locate(data, path, location);
+   if (res) {
+      return res;
+   }
+
+   return detail::with_encoded_field(v, [&](buffer::const_span_t item) {
+      return detail::overwrite(data, location, item);
+   });
+}
+
+template <typename T>
+[[nodiscard]] std::error_code update_in_place(buffer::span_t data, std::initializer_list<path_element> path, const T &v) {
+   return update_in_place(data, path_t{path.begin(), path.size()}, v);
+}
+
+/**
+ * Replace a nested data item, overwriting it in place if possible (see update_in_place()), and only replacing the
+ * data item's own bytes otherwise. The enclosing containers are left intact: CBOR containers count their elements, not
+ * their bytes.
+ *
+ * @param data Encoded data item.
+ * @param path Path to the nested data item to be replaced.
+ * @param v New value.
+ * @return Operation result. The data is left unchanged on failure.
+ */
+template <typename T>
+[[nodiscard]] std::error_code update(std::vector<std::byte> &data, path_t path, const T &v) {
+   field_location location{};
+   auto res = locate(data, path, location);
+   if (res) {
+      return res;
+   }
+
+   return detail::with_encoded_field(v, [&](buffer::const_span_t item) {
+      return detail::splice(data, location, item);
+   });
+}
+
+template <typename T>
+[[nodiscard]] std::error_code update(std::vector<std::byte> &data, std::initializer_list<path_element> path, const T &v) {
+   return update(data, path_t{path.begin(), path.size()}, v);
+}
+
+} // namespace cbor
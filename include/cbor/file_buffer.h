@@ -0,0 +1,188 @@
+/**
+ * @file   file_buffer.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#if !defined(_WIN32)
+
+#include <cbor/buffer.h>
+#include <cbor/error.h>
+#include <cbor/export.h>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace cbor {
+
+namespace detail {
+class file_io;
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: file_writer
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * File writer - buffer writing into a file through two alternating staging areas.
+ *
+ * Once a staging area is full, it is handed over to the kernel (via io_uring, if available), and encoding continues in
+ * the other one, so encoding and writing overlap. Without io_uring, staging areas are written with plain `pwrite`.
+ *
+ * Rollbacks are supported across staging areas: data that was already written is overwritten by subsequent writes,
+ * and the file is truncated to the right size on close.
+ */
+class CBOR_EXPORT file_writer final : public buffer {
+public:
+   inline static constexpr std::size_t default_staging_size = 256 * 1024;
+
+public:
+   /**
+    * Construct a writer.
+    * @param staging_size Size of a single staging area.
+    * @param use_io_uring Use io_uring if available (fall back to `pwrite` otherwise).
+    */
+   explicit file_writer(std::size_t staging_size = default_staging_size, bool use_io_uring = true);
+   ~file_writer() override;
+
+   file_writer(const file_writer &) = delete;
+   file_writer(file_writer &&) = delete;
+
+public:
+   file_writer &operator=(const file_writer &) = delete;
+   file_writer &operator=(file_writer &&) = delete;
+
+public:
+   //! Create (or truncate) a file for writing
+   [[nodiscard]] std::error_code open(const std::filesystem::path &path);
+
+   //! Write out all staged data, and wait for the writes to finish
+   [[nodiscard]] std::error_code flush();
+
+   //! Flush and close the file
+   [[nodiscard]] std::error_code close();
+
+   [[nodiscard]] bool uses_io_uring() const;
+
+public:
+   using buffer::write;
+
+   [[nodiscard]] std::error_code write(const_span_t v) override;
+   [[nodiscard]] std::size_t size() override { return base_ + staged_; };
+
+protected:
+   [[nodiscard]] rollback_token_t begin_nested_write() override;
+   void rollback_nested_write(rollback_token_t token) override;
+
+private:
+   [[nodiscard]] std::error_code submit();
+
+private:
+   std::unique_ptr<detail::file_io> io_;
+   std::array<std::vector<std::byte>, 2> staging_;
+   std::size_t current_{0};
+
+   //! File offset of the current staging area
+   std::uint64_t base_{0};
+
+   //! Number of bytes in the current staging area
+   std::size_t staged_{0};
+
+   //! Maximal file size ever written
+   std::uint64_t high_water_{0};
+
+   //! First asynchronous write error (reported by the next operation)
+   std::error_code error_{};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: file_reader
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * File reader - reads a file in windows, prefetching the next window while the current one is decoded.
+ *
+ * Bytes that are not consumed from a window are carried over to the beginning of the next one, so an item crossing a
+ * window boundary can be decoded after advancing. A single item should fit into a window.
+ *
+ * @code{.cpp}
+ * cbor::file_reader reader{};
+ * if (auto res = reader.open("events.cbor")) { ... }
+ *
+ * do {
+ *    cbor::read_buffer buf{reader.data()};
+ *    std::ptrdiff_t consumed = 0;
+ *    while (!cbor::decode(buf, event)) {
+ *       consumed = buf.read_position();
+ *       ...
+ *    }
+ *    reader.consume(consumed);
+ * } while (!reader.next());
+ * @endcode
+ */
+class CBOR_EXPORT file_reader final {
+public:
+   inline static constexpr std::size_t default_window_size = 256 * 1024;
+
+public:
+   /**
+    * Construct a reader.
+    * @param window_size Number of bytes to read at once.
+    * @param use_io_uring Use io_uring if available (fall back to `pread` otherwise).
+    */
+   explicit file_reader(std::size_t window_size = default_window_size, bool use_io_uring = true);
+   ~file_reader();
+
+   file_reader(const file_reader &) = delete;
+   file_reader(file_reader &&) = delete;
+
+public:
+   file_reader &operator=(const file_reader &) = delete;
+   file_reader &operator=(file_reader &&) = delete;
+
+public:
+   //! Open a file, read the first window and start prefetching the next one
+   [[nodiscard]] std::error_code open(const std::filesystem::path &path);
+   void close();
+
+   //! Unconsumed data of the current window
+   [[nodiscard]] buffer::const_span_t data() const {
+      return buffer::const_span_t{staging_[current_]}.subspan(begin_, end_ - begin_);
+   }
+
+   //! Mark the first `size` bytes of data() as consumed
+   void consume(std::size_t size);
+
+   /**
+    * Move to the next window.
+    * @return Operation result, buffer_underflow at the end of the file, buffer_overflow if the unconsumed data doesn't
+    *         fit into a window.
+    */
+   [[nodiscard]] std::error_code next();
+
+   [[nodiscard]] bool uses_io_uring() const;
+
+private:
+   [[nodiscard]] std::error_code prefetch(std::size_t target);
+
+private:
+   std::unique_ptr<detail::file_io> io_;
+   std::size_t window_size_;
+
+   //! Every staging area is two windows long: a prefetched window is preceded by the carried over bytes
+   std::array<std::vector<std::byte>, 2> staging_;
+   std::size_t current_{0};
+   std::size_t begin_{0};
+   std::size_t end_{0};
+
+   //! File offset of the next prefetch
+   std::uint64_t offset_{0};
+   bool prefetching_{false};
+};
+
+} // namespace cbor
+
+#endif // !defined(_WIN32)
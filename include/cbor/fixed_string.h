@@ -0,0 +1,123 @@
+/**
+ * @file   fixed_string.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/decoding.h>
+#include <cbor/encoding.h>
+#include <cbor/error.h>
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace cbor {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: fixed_string
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Fixed-capacity string - stores up to N characters inline, without any heap allocations.
+ *
+ * Has the same encoding as std::string, so both types can be used interchangeably on the different sides of a
+ * connection. Decoding a text string longer than N characters fails with error::buffer_overflow.
+ *
+ * @code{.cpp}
+ * struct quote {
+ *    cbor::fixed_string<8> symbol;
+ *    double price;
+ * };
+ *
+ * quote q{.symbol = "ACME", .price = 1.5};
+ * @endcode
+ */
+template <std::size_t N>
+class fixed_string {
+public:
+   using value_type = char;
+   using size_type = std::size_t;
+   using iterator = const char *;
+   using const_iterator = const char *;
+
+public:
+   constexpr fixed_string() = default;
+
+   //! Construct from a string literal, the length is checked at compile time
+   template <std::size_t M>
+      requires(M - 1 <= N)
+   constexpr fixed_string(const char (&v)[M])
+      : size_{M - 1} {
+      for (std::size_t i = 0; i < size_; ++i) {
+         data_[i] = v[i];
+      }
+   }
+
+public:
+   /**
+    * Replace the contents.
+    * @param v New contents.
+    * @return Operation result, buffer_overflow if the string doesn't fit (the contents are kept unchanged).
+    */
+   [[nodiscard]] std::error_code assign(std::string_view v) {
+      if (v.size() > N) {
+         return error::buffer_overflow;
+      }
+
+      v.copy(data_.data(), v.size());
+      size_ = v.size();
+      return error::success;
+   }
+
+   constexpr void clear() { size_ = 0; }
+
+   [[nodiscard]] constexpr std::string_view view() const { return {data_.data(), size_}; }
+   [[nodiscard]] constexpr operator std::string_view() const { return view(); }
+
+   [[nodiscard]] constexpr const char *data() const { return data_.data(); }
+   [[nodiscard]] constexpr std::size_t size() const { return size_; }
+   [[nodiscard]] constexpr bool empty() const { return size_ == 0; }
+   [[nodiscard]] static constexpr std::size_t capacity() { return N; }
+
+   [[nodiscard]] constexpr const_iterator begin() const { return data_.data(); }
+   [[nodiscard]] constexpr const_iterator end() const { return data_.data() + size_; }
+
+   template <std::size_t M>
+   [[nodiscard]] friend constexpr bool operator==(const fixed_string &lhs, const fixed_string<M> &rhs) {
+      return lhs.view() == rhs.view();
+   }
+
+   [[nodiscard]] friend constexpr bool operator==(const fixed_string &lhs, std::string_view rhs) {
+      return lhs.view() == rhs;
+   }
+
+private:
+   template <std::size_t M>
+   friend std::error_code decode(read_buffer &buf, fixed_string<M> &v);
+
+   std::array<char, N> data_{};
+   std::size_t size_{0};
+};
+
+template <std::size_t N>
+[[nodiscard]] std::error_code encode(buffer &buf, const fixed_string<N> &v) {
+   return encode(buf, v.view());
+}
+
+template <std::size_t N>
+[[nodiscard]] std::error_code decode(read_buffer &buf, fixed_string<N> &v) {
+   std::size_t size{0};
+   auto res = decode(buf, std::span<char>{v.data_}, size);
+   if (res) {
+      return res;
+   }
+
+   v.size_ = size;
+   return error::success;
+}
+
+} // namespace cbor
@@ -0,0 +1,79 @@
+/**
+ * @file   read_buffer.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ *
+ * Definitions of the read buffer functions. Compiled into the library, or included by cbor/buffer.h when building with
+ * the header-only codec.
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/config.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace cbor {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: read_buffer
+////////////////////////////////////////////////////////////////////////////////
+CBOR_CODEC_INLINE read_buffer::read_buffer(buffer::const_span_t span)
+   : span_{span} {
+   // Nothing to do here
+}
+
+CBOR_CODEC_INLINE std::error_code read_buffer::read(std::byte &v) {
+   if (!span_.data()) {
+      return error::invalid_usage;
+   }
+
+   if (span_.size() - read_position_ <= 0) {
+      return error::buffer_underflow;
+   }
+
+   v = span_[read_position_++];
+
+   return error::success;
+}
+
+CBOR_CODEC_INLINE std::error_code read_buffer::read(buffer::span_t v) {
+   if (!span_.data()) {
+      return error::invalid_usage;
+   }
+
+   if (!v.data()) {
+      return error::invalid_usage;
+   }
+
+   if (span_.size() - read_position_ < v.size()) {
+      return error::buffer_underflow;
+   }
+
+   using diff_t = std::iterator_traits<buffer::const_span_t::iterator>::difference_type;
+   auto begin = span_.begin() + read_position_;
+   auto end = begin + static_cast<diff_t>(v.size());
+   std::copy(begin, end, v.begin());
+
+   read_position_ += static_cast<decltype(read_position_)>(v.size());
+
+   return error::success;
+}
+
+CBOR_CODEC_INLINE std::error_code read_buffer::skip(std::size_t size) {
+   if (!span_.data()) {
+      return error::invalid_usage;
+   }
+
+   if (span_.size() - read_position_ < size) {
+      return error::buffer_underflow;
+   }
+
+   read_position_ += static_cast<decltype(read_position_)>(size);
+
+   return error::success;
+}
+
+} // namespace cbor
@@ -0,0 +1,61 @@
+/**
+ * @file   mapped_file.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/export.h>
+
+#include <filesystem>
+#include <system_error>
+
+namespace cbor {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: mapped_file
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Mapped file - read-only memory mapping of a whole file.
+ *
+ * Allows decoding (and seeking in) large CBOR sequences without reading them into memory first:
+ * @code{.cpp}
+ * cbor::mapped_file file{};
+ * if (auto res = file.open("events.cbor")) { ... }
+ *
+ * cbor::read_buffer buf{file.data()};
+ * if (auto res = index.seek(buf, 1'000'000)) { ... }
+ * @endcode
+ */
+class CBOR_EXPORT mapped_file final {
+public:
+   mapped_file() = default;
+   ~mapped_file();
+
+   mapped_file(const mapped_file &) = delete;
+   mapped_file(mapped_file &&o) noexcept;
+
+public:
+   mapped_file &operator=(const mapped_file &) = delete;
+   mapped_file &operator=(mapped_file &&o) noexcept;
+
+public:
+   /**
+    * Map a file into memory, closing any previously mapped file.
+    * @param path File path.
+    * @return Operation result (system error code on failure).
+    */
+   [[nodiscard]] std::error_code open(const std::filesystem::path &path);
+   void close();
+
+   [[nodiscard]] bool is_open() const { return data_ != nullptr; }
+   [[nodiscard]] buffer::const_span_t data() const { return {data_, size_}; }
+
+private:
+   const std::byte *data_{nullptr};
+   std::size_t size_{0};
+};
+
+} // namespace cbor
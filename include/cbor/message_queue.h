@@ -0,0 +1,197 @@
+/**
+ * @file   message_queue.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/encoding.h>
+#include <cbor/error.h>
+#include <cbor/export.h>
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+namespace cbor {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: message_queue
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Message queue - bounded lock-free multi-producer/multi-consumer queue of encoded messages.
+ *
+ * The queue consists of a fixed number of fixed-size slots. A producer reserves a slot, encodes a message directly
+ * into it and publishes it. Consumers drain published messages in batches, in reservation order. A reserved slot blocks
+ * consumers until it is either published or discarded, so producers should not hold on to reserved slots.
+ *
+ * @code{.cpp}
+ * cbor::message_queue queue{1024, 256};
+ *
+ * // Any producer thread
+ * if (auto res = queue.push(log_entry{...})) { ... }
+ *
+ * // Consumer thread
+ * queue.drain([](cbor::buffer::const_span_t message) { ... });
+ * @endcode
+ */
+class CBOR_EXPORT message_queue final {
+   struct slot;
+
+public:
+   inline static constexpr std::size_t unlimited = std::numeric_limits<std::size_t>::max();
+
+   /**
+    * Writer - buffer for encoding a message directly into a reserved slot.
+    *
+    * Writing past the slot size results in a buffer_overflow error. A reserved slot that wasn't published by the time
+    * the writer is destroyed is discarded, and skipped by consumers.
+    */
+   class CBOR_EXPORT writer final : public buffer {
+   public:
+      writer() = default;
+      ~writer() override;
+
+      writer(const writer &) = delete;
+      writer(writer &&o) noexcept;
+
+   public:
+      writer &operator=(const writer &) = delete;
+      writer &operator=(writer &&o) noexcept;
+
+   public:
+      using buffer::write;
+
+      [[nodiscard]] std::error_code write(const_span_t v) override;
+      [[nodiscard]] std::size_t size() override { return size_; };
+
+      [[nodiscard]] bool has_slot() const { return slot_ != nullptr; }
+
+      //! Make the encoded message visible to the consumers and release the slot
+      void publish();
+
+      //! Release the slot without publishing anything
+      void discard();
+
+   protected:
+      [[nodiscard]] rollback_token_t begin_nested_write() override;
+      void rollback_nested_write(rollback_token_t token) override;
+
+   private:
+      void finish(bool discarded);
+
+   private:
+      friend class message_queue;
+
+      slot *slot_{nullptr};
+      std::byte *data_{nullptr};
+      std::size_t capacity_{0};
+      std::uint64_t position_{0};
+      std::size_t size_{0};
+   };
+
+public:
+   /**
+    * Construct a queue.
+    * @param slot_count Number of slots, rounded up to a power of two.
+    * @param slot_size Maximal size of a single encoded message.
+    */
+   message_queue(std::size_t slot_count, std::size_t slot_size);
+   ~message_queue();
+
+   message_queue(const message_queue &) = delete;
+   message_queue(message_queue &&) = delete;
+
+public:
+   message_queue &operator=(const message_queue &) = delete;
+   message_queue &operator=(message_queue &&) = delete;
+
+public:
+   /**
+    * Reserve a slot for encoding a message into.
+    * @param[out] w Writer to assign the reserved slot to (any previously held slot is discarded).
+    * @return Operation result, buffer_overflow if the queue is full.
+    */
+   [[nodiscard]] std::error_code reserve(writer &w);
+
+   /**
+    * Encode and publish a message.
+    * @param v Value to be encoded.
+    * @return Operation result, buffer_overflow if the queue is full or if the value doesn't fit into a slot.
+    */
+   template <Encodable T>
+   [[nodiscard]] std::error_code push(const T &v) {
+      writer w{};
+      auto res = reserve(w);
+      if (res) {
+         return res;
+      }
+
+      res = encode(w, v);
+      if (res) {
+         w.discard();
+         return res;
+      }
+
+      w.publish();
+      return error::success;
+   }
+
+   /**
+    * Consume a batch of published messages.
+    *
+    * Message views are only valid during the handler invocation.
+    *
+    * @param handler Callable, invoked with a buffer::const_span_t for every message.
+    * @param max_messages Maximal number of messages to consume.
+    * @return Number of consumed messages.
+    */
+   template <typename Handler>
+   std::size_t drain(Handler &&handler, std::size_t max_messages = unlimited) {
+      std::size_t count = 0;
+      while (count < max_messages) {
+         slot *s{nullptr};
+         buffer::const_span_t message{};
+         bool discarded{false};
+         if (!claim(s, message, discarded)) {
+            break;
+         }
+
+         // Make sure the slot is released, even if the handler throws
+         const slot_releaser releaser{this, s};
+         if (!discarded) {
+            ++count;
+            handler(message);
+         }
+      }
+      return count;
+   }
+
+   [[nodiscard]] std::size_t slot_count() const { return mask_ + 1; }
+   [[nodiscard]] std::size_t slot_size() const { return slot_size_; }
+
+private:
+   struct slot_releaser {
+      message_queue *queue;
+      slot *s;
+
+      ~slot_releaser() { queue->release(s); }
+   };
+
+   [[nodiscard]] bool claim(slot *&s, buffer::const_span_t &message, bool &discarded);
+   void release(slot *s);
+
+private:
+   std::size_t mask_;
+   std::size_t slot_size_;
+   std::unique_ptr<slot[]> slots_;
+   std::unique_ptr<std::byte[]> storage_;
+
+   alignas(64) std::atomic<std::uint64_t> enqueue_position_{0};
+   alignas(64) std::atomic<std::uint64_t> dequeue_position_{0};
+};
+
+} // namespace cbor
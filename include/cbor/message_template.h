@@ -0,0 +1,240 @@
+/**
+ * @file   message_template.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/encoding.h>
+#include <cbor/error.h>
+#include <cbor/type_traits.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cbor {
+
+namespace detail {
+
+//! Fields that can be encoded with a fixed width, independent of the value
+template <typename T>
+concept PatchableField = Int<T> || Enum<T> || IsBool<T>;
+
+template <typename T>
+struct fixed_field_int {
+   using type = T;
+};
+
+template <Enum T>
+struct fixed_field_int<T> {
+   using type = std::underlying_type_t<T>;
+};
+
+template <typename T>
+using fixed_field_int_t = typename fixed_field_int<T>::type;
+
+template <std::size_t Size>
+using fixed_width_uint_t = std::conditional_t<
+   Size == 1,
+   std::uint8_t,
+   std::conditional_t<Size == 2, std::uint16_t, std::conditional_t<Size == 4, std::uint32_t, std::uint64_t>>>;
+
+template <PatchableField T>
+inline constexpr std::size_t fixed_field_size_v = IsBool<T> ? 1 : 1 + sizeof(fixed_field_int_t<T>);
+
+/**
+ * Encode a field with a fixed width.
+ *
+ * Integers are encoded as with detail::encode_argument(..., compress = false), the argument always occupies as many
+ * bytes as the integer type.
+ */
+template <PatchableField T>
+constexpr std::array<std::byte, fixed_field_size_v<T>> encode_fixed_field(T v) {
+   std::array<std::byte, fixed_field_size_v<T>> result{};
+
+   if constexpr (IsBool<T>) {
+      result[0] = major_type::simple | (v ? simple_type::true_type : simple_type::false_type);
+   } else {
+      using int_t = fixed_field_int_t<T>;
+      using unsigned_t = fixed_width_uint_t<sizeof(int_t)>;
+
+      const auto as_int = static_cast<int_t>(v);
+
+      auto type = major_type::unsigned_int;
+      auto argument = static_cast<unsigned_t>(as_int);
+      if constexpr (SignedInt<int_t>) {
+         if (as_int < 0) {
+            type = major_type::signed_int;
+            argument = static_cast<unsigned_t>(static_cast<int_t>(-1) - as_int);
+         }
+      }
+
+      constexpr auto size = sizeof(unsigned_t) == 1   ? argument_size::one_byte
+                            : sizeof(unsigned_t) == 2 ? argument_size::two_bytes
+                            : sizeof(unsigned_t) == 4 ? argument_size::four_bytes
+                                                      : argument_size::eight_bytes;
+      result[0] = type | size;
+
+      for (std::size_t i = 0; i < sizeof(unsigned_t); ++i) {
+         const auto shift = (sizeof(unsigned_t) - 1 - i) * 8U;
+         result[i + 1] = static_cast<std::byte>((static_cast<std::uint64_t>(argument) >> shift) & 0xFFU);
+      }
+   }
+
+   return result;
+}
+
+template <PatchableField T>
+[[nodiscard]] std::error_code encode_fixed_field(buffer &buf, T v) {
+   if constexpr (IsBool<T>) {
+      return encode(buf, v);
+   } else {
+      using int_t = fixed_field_int_t<T>;
+      using unsigned_t = fixed_width_uint_t<sizeof(int_t)>;
+
+      const auto as_int = static_cast<int_t>(v);
+      if constexpr (SignedInt<int_t>) {
+         if (as_int < 0) {
+            const auto argument = static_cast<unsigned_t>(static_cast<int_t>(-1) - as_int);
+            return encode_argument(buf, major_type::signed_int, argument, false);
+         }
+      }
+
+      return encode_argument(buf, major_type::unsigned_int, static_cast<unsigned_t>(as_int), false);
+   }
+}
+
+template <std::size_t Needle, std::size_t... Haystack>
+consteval std::size_t index_of() {
+   std::size_t idx = 0;
+   ((Needle == Haystack ? false : (++idx, true)) && ...);
+   return idx;
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: message_template
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Message template - pre-encoded struct with patchable fields.
+ *
+ * The prototype is encoded once, with the selected (integer, enum or bool) members encoded with a fixed width, so new
+ * messages can be produced by copying the prototype bytes and patching those fields in place, without encoding.
+ *
+ * Fixed-width fields are not the shortest possible encoding, but are well-formed and decodable as usual.
+ *
+ * @code{.cpp}
+ * // Patch the request ID (member 0) and the status (member 2)
+ * cbor::message_template<response, 0, 2> tmpl{};
+ * if (auto res = tmpl.assign(response{.id = 0, .body = "static body", .status = status::ok})) { ... }
+ *
+ * (void)tmpl.set<0>(request.id);
+ * socket.send(tmpl.bytes());
+ * @endcode
+ *
+ * @tparam T Struct type.
+ * @tparam Fields Indices of the patchable members.
+ */
+template <EncodableStruct T, std::size_t... Fields>
+   requires(sizeof...(Fields) > 0) && ((Fields < get_member_count<T>()) && ...) &&
+           (detail::PatchableField<member_type_t<T, Fields>> && ...)
+class message_template {
+public:
+   template <std::size_t Field>
+   using field_t = member_type_t<T, Field>;
+
+public:
+   /**
+    * Encode the prototype.
+    * @param prototype Message with the values for all non-patchable fields.
+    * @return Operation result.
+    */
+   [[nodiscard]] std::error_code assign(const T &prototype) {
+      std::vector<std::byte> bytes{};
+      dynamic_buffer buf{bytes};
+
+      auto res = encode_argument(buf, major_type::array, get_member_count<T>());
+      if (res) {
+         return res;
+      }
+
+      res = encode_members(buf, prototype, std::make_index_sequence<get_member_count<T>()>{});
+      if (res) {
+         return res;
+      }
+
+      bytes_ = std::move(bytes);
+      return error::success;
+   }
+
+   /**
+    * Update a field of the template.
+    * @return Operation result, invalid_usage if the template is not assigned.
+    */
+   template <std::size_t Field>
+   [[nodiscard]] std::error_code set(field_t<Field> v) {
+      return patch<Field>(bytes_, v);
+   }
+
+   /**
+    * Update a field in a copy of the template.
+    * @param message Copy of the template bytes.
+    * @param v New value.
+    * @return Operation result, invalid_usage if the message is too short.
+    */
+   template <std::size_t Field>
+   [[nodiscard]] std::error_code patch(buffer::span_t message, field_t<Field> v) const {
+      const auto field = detail::encode_fixed_field(v);
+      const auto offset = offset_of<Field>();
+      if (bytes_.empty() || message.size() < offset + field.size()) {
+         return error::invalid_usage;
+      }
+
+      std::memcpy(message.data() + offset, field.data(), field.size());
+      return error::success;
+   }
+
+   //! Encoded message, including all patches made with set()
+   [[nodiscard]] buffer::const_span_t bytes() const { return bytes_; }
+
+   //! Copy the encoded message into a buffer
+   [[nodiscard]] std::error_code write(buffer &buf) const { return buf.write(bytes()); }
+
+   //! Offset of a field's head within the encoded message
+   template <std::size_t Field>
+   [[nodiscard]] std::size_t offset_of() const {
+      return offsets_[detail::index_of<Field, Fields...>()];
+   }
+
+private:
+   template <std::size_t... Ns>
+   [[nodiscard]] std::error_code encode_members(buffer &buf, const T &v, std::index_sequence<Ns...>) {
+      std::error_code ec;
+      ((ec = encode_member<Ns>(buf, v), !ec) && ...);
+      return ec;
+   }
+
+   template <std::size_t Idx>
+   [[nodiscard]] std::error_code encode_member(buffer &buf, const T &v) {
+      if constexpr (((Idx == Fields) || ...)) {
+         offsets_[detail::index_of<Idx, Fields...>()] = buf.size();
+         return detail::encode_fixed_field(buf, get_member<Idx>(v));
+      } else {
+         return encode(buf, get_member<Idx>(v));
+      }
+   }
+
+private:
+   std::vector<std::byte> bytes_{};
+   std::array<std::size_t, sizeof...(Fields)> offsets_{};
+};
+
+} // namespace cbor
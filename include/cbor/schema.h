@@ -0,0 +1,473 @@
+/**
+ * @file   schema.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/decoding.h>
+#include <cbor/encoded.h>
+#include <cbor/encoding.h>
+#include <cbor/fixed_string.h>
+#include <cbor/static_vector.h>
+#include <cbor/type_traits.h>
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace cbor {
+
+namespace detail {
+
+template <typename T>
+struct is_string : std::false_type {};
+
+template <typename CharT, typename Traits, typename Allocator>
+struct is_string<std::basic_string<CharT, Traits, Allocator>> : std::true_type {};
+
+template <typename T>
+struct is_vector : std::false_type {};
+
+template <typename T, typename Allocator>
+struct is_vector<std::vector<T, Allocator>> : std::true_type {};
+
+template <typename T>
+struct is_byte_vector : std::false_type {};
+
+template <typename T, typename Allocator>
+struct is_byte_vector<std::vector<T, Allocator>> : std::bool_constant<is_byte_v<T>> {};
+
+template <typename T>
+struct is_columnar_vector : std::false_type {};
+
+template <typename T, typename Allocator>
+struct is_columnar_vector<std::vector<T, Allocator>> : std::bool_constant<is_columnar_v<T>> {};
+
+template <typename T>
+struct is_fixed_string : std::false_type {};
+
+template <std::size_t N>
+struct is_fixed_string<fixed_string<N>> : std::true_type {};
+
+template <typename T>
+struct is_static_vector : std::false_type {};
+
+template <typename T, std::size_t N>
+struct is_static_vector<static_vector<T, N>> : std::true_type {};
+
+template <typename T>
+struct is_bit_vector : std::false_type {};
+
+template <typename Allocator>
+struct is_bit_vector<std::vector<bool, Allocator>> : std::true_type {};
+
+template <std::size_t N>
+struct is_bit_vector<std::bitset<N>> : std::true_type {};
+
+template <typename T>
+struct is_std_array : std::false_type {};
+
+template <typename T, std::size_t Extent>
+struct is_std_array<std::array<T, Extent>> : std::true_type {};
+
+template <typename T>
+struct is_optional : std::false_type {};
+
+template <typename T>
+struct is_optional<std::optional<T>> : std::true_type {};
+
+template <typename T>
+struct is_encoded : std::false_type {};
+
+template <typename T>
+struct is_encoded<encoded<T>> : std::true_type {};
+
+template <typename T>
+inline constexpr bool dependent_false_v = false;
+
+//! Building blocks of a schema description, only used for hashing
+enum class schema_token : std::uint8_t {
+   unsigned_int = 1,
+   signed_int,
+   boolean,
+   floating_point,
+   text_string,
+   byte_string,
+   optional,
+   array,
+   fixed_array,
+   dictionary,
+   variant,
+   tagged_variant,
+   structure,
+   custom,
+   bit_vector,
+   columnar,
+};
+
+//! FNV-1a: a simple hash, which is easy to evaluate at compile-time
+inline constexpr std::uint64_t fingerprint_basis = 0xCBF29CE484222325ULL;
+inline constexpr std::uint64_t fingerprint_prime = 0x100000001B3ULL;
+
+constexpr std::uint64_t fingerprint_mix(std::uint64_t h, std::uint64_t v) {
+   for (unsigned i = 0; i < 8; ++i) {
+      h ^= (v >> (i * 8U)) & 0xFFU;
+      h *= fingerprint_prime;
+   }
+   return h;
+}
+
+constexpr std::uint64_t fingerprint_mix(std::uint64_t h, schema_token t) {
+   return fingerprint_mix(h, static_cast<std::uint64_t>(t));
+}
+
+template <typename T>
+consteval std::uint64_t fingerprint(std::uint64_t h);
+
+template <typename T, std::size_t... Ns>
+consteval std::uint64_t fingerprint_members(std::uint64_t h, std::index_sequence<Ns...>) {
+   ((h = fingerprint<decltype(get_member<Ns>(std::declval<const T &>()))>(h)), ...);
+   return h;
+}
+
+template <typename... T>
+consteval std::uint64_t fingerprint_alternatives(std::uint64_t h, std::type_identity<std::variant<T...>>) {
+   ((h = fingerprint<T>(fingerprint_mix(h, static_cast<std::uint64_t>(type_id_v<T>)))), ...);
+   return h;
+}
+
+template <typename T>
+consteval std::uint64_t fingerprint(std::uint64_t h) {
+   using U = std::remove_cvref_t<T>;
+
+   if constexpr (IsBool<U>) {
+      return fingerprint_mix(h, schema_token::boolean);
+   } else if constexpr (Enum<U>) {
+      // Enums are encoded as their underlying type
+      return fingerprint<std::underlying_type_t<U>>(h);
+   } else if constexpr (UnsignedInt<U>) {
+      return fingerprint_mix(fingerprint_mix(h, schema_token::unsigned_int), sizeof(U));
+   } else if constexpr (SignedInt<U>) {
+      return fingerprint_mix(fingerprint_mix(h, schema_token::signed_int), sizeof(U));
+   } else if constexpr (std::is_floating_point_v<U>) {
+      return fingerprint_mix(fingerprint_mix(h, schema_token::floating_point), sizeof(U));
+   } else if constexpr (is_string<U>::value || is_fixed_string<U>::value || std::is_same_v<U, std::string_view> ||
+                        std::is_same_v<U, const char *>) {
+      // Fixed-capacity containers share the encoding with the dynamic ones
+      return fingerprint_mix(h, schema_token::text_string);
+   } else if constexpr (std::is_same_v<U, buffer::const_span_t>) {
+      return fingerprint_mix(h, schema_token::byte_string);
+   } else if constexpr (is_encoded<U>::value) {
+      // Pre-encoded values have the same layout as the values themselves
+      return fingerprint<typename U::value_type>(h);
+   } else if constexpr (is_optional<U>::value) {
+      return fingerprint<typename U::value_type>(fingerprint_mix(h, schema_token::optional));
+   } else if constexpr (detail::is_variant<U>::value) {
+      h = fingerprint_mix(h, is_tagged_variant_v<U> ? schema_token::tagged_variant : schema_token::variant);
+      h = fingerprint_mix(h, std::variant_size_v<U>);
+      return fingerprint_alternatives(h, std::type_identity<U>{});
+   } else if constexpr (is_std_array<U>::value) {
+      // Fixed-size byte arrays are byte strings, everything else is an array
+      const auto token = IsByte<typename U::value_type> ? schema_token::byte_string : schema_token::fixed_array;
+      h = fingerprint_mix(fingerprint_mix(h, token), std::tuple_size_v<U>);
+      return IsByte<typename U::value_type> ? h : fingerprint<typename U::value_type>(h);
+   } else if constexpr (is_bit_vector<U>::value) {
+      // Bitsets and vectors of booleans share the encoding, but bitsets have a fixed size
+      h = fingerprint_mix(h, schema_token::bit_vector);
+      if constexpr (is_vector<U>::value) {
+         return h;
+      } else {
+         return fingerprint_mix(h, U{}.size());
+      }
+   } else if constexpr (is_vector<U>::value || is_static_vector<U>::value) {
+      if constexpr (IsByte<typename U::value_type>) {
+         return fingerprint_mix(h, schema_token::byte_string);
+      } else if constexpr (is_columnar_vector<U>::value) {
+         // Columns have the same layout as the rows: every column is derived from a struct member
+         return fingerprint<typename U::value_type>(fingerprint_mix(h, schema_token::columnar));
+      } else {
+         return fingerprint<typename U::value_type>(fingerprint_mix(h, schema_token::array));
+      }
+   } else if constexpr (Dictionary<U>) {
+      h = fingerprint_mix(h, schema_token::dictionary);
+      return fingerprint<mapped_type_t<U>>(fingerprint<key_type_t<U>>(h));
+   } else if constexpr (EncodableStruct<U>) {
+      h = fingerprint_mix(fingerprint_mix(h, schema_token::structure), get_member_count<U>());
+      return fingerprint_members<U>(h, std::make_index_sequence<get_member_count<U>()>{});
+   } else if constexpr (WithTypeID<U>) {
+      // Types with custom encoding functions can only be identified by their type ID
+      return fingerprint_mix(fingerprint_mix(h, schema_token::custom), static_cast<std::uint64_t>(type_id_v<U>));
+   } else {
+      static_assert(dependent_false_v<U>, "Unable to derive the schema of a type, consider adding a type_id");
+      return h;
+   }
+}
+
+} // namespace detail
+
+/**
+ * Schema fingerprint: a compile-time hash of a type's CBOR layout.
+ *
+ * The hash covers the member types of reflected structs (recursively), container and variant layouts, integer widths
+ * and signedness, as well as the type IDs of variant alternatives and of the types with custom encoding. Field names
+ * are not part of the encoding, and thus not a part of the fingerprint either.
+ *
+ * Peers can exchange the fingerprint once (e.g., per connection), and switch to decode_trusted() if they match.
+ */
+template <typename T>
+inline constexpr std::uint64_t schema_fingerprint_v = detail::fingerprint<T>(detail::fingerprint_basis);
+
+/**
+ * Encode the schema fingerprint of a type.
+ */
+template <typename T>
+[[nodiscard]] std::error_code encode_fingerprint(buffer &buf) {
+   return encode(buf, schema_fingerprint_v<T>);
+}
+
+/**
+ * Decode a schema fingerprint, and check it against the local schema of a type.
+ * @param[in] buf Buffer to decode the fingerprint from.
+ * @param[out] matches Set to true if the remote schema matches the local one.
+ * @return Operation result.
+ */
+template <typename T>
+[[nodiscard]] std::error_code decode_fingerprint(read_buffer &buf, bool &matches) {
+   std::uint64_t fingerprint{};
+   auto res = decode(buf, fingerprint);
+   if (res) {
+      return res;
+   }
+
+   matches = fingerprint == schema_fingerprint_v<T>;
+   return error::success;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Trusted decoding
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Decode a value, trusting the input to match the type's schema.
+ *
+ * Intended for the peers with a matching schema_fingerprint_v: the major types, struct member counts and integer
+ * ranges are not validated, the data item heads are only used for their arguments. Bounds checks are retained,
+ * so malformed input can only result in garbage values or an error, and never in out-of-bounds reads, or in
+ * allocations larger than the input.
+ *
+ * Floats and types with custom decoding functions are decoded with the regular, checked, decode() function.
+ *
+ * @code{.cpp}
+ * bool trusted = false;
+ * auto res = cbor::decode_fingerprint<message>(handshake_buf, trusted);
+ * ...
+ * res = trusted ? cbor::decode_trusted(buf, msg) : cbor::decode(buf, msg);
+ * @endcode
+ *
+ * @param[in] buf Buffer to decode the value from.
+ * @param[out] v Value to be decoded.
+ * @return Operation result.
+ */
+template <typename T>
+[[nodiscard]] std::error_code decode_trusted(read_buffer &buf, T &v) {
+   using namespace cbor::detail;
+
+   if constexpr (IsBool<T>) {
+      std::byte b;
+      auto res = buf.read(b);
+      if (res) {
+         return res;
+      }
+
+      v = b == (major_type::simple | simple_type::true_type);
+      return error::success;
+   } else if constexpr (Enum<T>) {
+      std::underlying_type_t<T> as_int{};
+      auto res = decode_trusted(buf, as_int);
+      if (res) {
+         return res;
+      }
+
+      v = static_cast<T>(as_int);
+      return error::success;
+   } else if constexpr (Int<T>) {
+      head head{};
+      auto res = head.read(buf);
+      if (res) {
+         return res;
+      }
+
+      const auto u64 = head.decode_argument();
+      if constexpr (SignedInt<T>) {
+         if (head.type == major_type::signed_int) {
+            v = static_cast<T>(static_cast<std::int64_t>(-1) - static_cast<std::int64_t>(u64));
+            return error::success;
+         }
+      }
+
+      v = static_cast<T>(u64);
+      return error::success;
+   } else if constexpr (is_string<T>::value || is_byte_vector<T>::value) {
+      static_assert(sizeof(value_type_t<T>) == sizeof(std::byte));
+
+      head head{};
+      auto res = head.read(buf);
+      if (res) {
+         return res;
+      }
+
+      buffer::const_span_t bytes{};
+      res = read_view(buf, head.decode_argument(), bytes);
+      if (res) {
+         return res;
+      }
+
+      const auto first = reinterpret_cast<const value_type_t<T> *>(bytes.data());
+      v.assign(first, first + bytes.size());
+      return error::success;
+   } else if constexpr (is_optional<T>::value) {
+      const auto position = buf.read_position();
+
+      std::byte b;
+      auto res = buf.read(b);
+      if (res) {
+         return res;
+      }
+
+      if (b == (major_type::simple | simple_type::null_type)) {
+         v = std::nullopt;
+         return error::success;
+      }
+
+      buf.reset(position);
+      return decode_trusted(buf, v.emplace());
+   } else if constexpr (detail::is_variant<T>::value) {
+      std::int64_t type_id;
+      auto res = decode_variant_head<T>(buf, type_id);
+      if (res) {
+         return res;
+      }
+
+      const auto try_decode = [&]<typename A>(std::type_identity<A>) {
+         if (static_cast<std::int64_t>(type_id_v<A>) != type_id) {
+            // Not the encoded type - return true to continue search
+            return true;
+         }
+
+         res = decode_trusted(buf, v.template emplace<A>());
+         return false;
+      };
+
+      const bool missing_type = [&]<typename... A>(std::type_identity<std::variant<A...>>) {
+         return (try_decode(std::type_identity<A>{}) && ...);
+      }(std::type_identity<T>{});
+
+      if (missing_type) {
+         // The encoded value is not in the variant's alternatives set
+         return error::unexpected_type;
+      }
+      return res;
+   } else if constexpr (DecodableStruct<T>) {
+      // The number of members is not checked, it is a part of the schema
+      head head{};
+      auto res = head.read(buf);
+      if (res) {
+         return res;
+      }
+
+      [&]<std::size_t... Ns>(std::index_sequence<Ns...>) {
+         ((res = decode_trusted(buf, get_member_non_const<Ns>(v)), !res) && ...);
+      }(std::make_index_sequence<get_member_count<T>()>{});
+      return res;
+   } else if constexpr (is_std_array<T>::value) {
+      if constexpr (IsByte<value_type_t<T>>) {
+         // Byte strings have to be exactly of the array size
+         return decode(buf, v);
+      } else {
+         head head{};
+         auto res = head.read(buf);
+         if (res) {
+            return res;
+         }
+
+         for (auto &e : v) {
+            res = decode_trusted(buf, e);
+            if (res) {
+               return res;
+            }
+         }
+         return error::success;
+      }
+   } else if constexpr (is_bit_vector<T>::value) {
+      // Packed bits are already decoded in bulk
+      return decode(buf, v);
+   } else if constexpr (is_columnar_vector<T>::value) {
+      // Column sizes have to be checked against each other anyway
+      return decode(buf, v);
+   } else if constexpr (is_vector<T>::value) {
+      head head{};
+      auto res = head.read(buf);
+      if (res) {
+         return res;
+      }
+
+      const auto size = head.decode_argument();
+      res = check_remaining(buf, size);
+      if (res) {
+         return res;
+      }
+
+      v.resize(size);
+      for (auto &e : v) {
+         res = decode_trusted(buf, e);
+         if (res) {
+            return res;
+         }
+      }
+      return error::success;
+   } else if constexpr (Dictionary<T> && DecodableDictionary<T>) {
+      head head{};
+      auto res = head.read(buf);
+      if (res) {
+         return res;
+      }
+
+      const auto num_pairs = head.decode_argument();
+      res = check_remaining(buf, num_pairs, 2);
+      if (res) {
+         return res;
+      }
+
+      for (std::uint64_t i = 0; i < num_pairs; ++i) {
+         key_type_t<T> key;
+         res = decode_trusted(buf, key);
+         if (res) {
+            return res;
+         }
+
+         mapped_type_t<T> value;
+         res = decode_trusted(buf, value);
+         if (res) {
+            return res;
+         }
+
+         v.insert(value_type_t<T>{std::move(key), std::move(value)});
+      }
+      return error::success;
+   } else {
+      // Floats and custom types
+      return decode(buf, v);
+   }
+}
+
+} // namespace cbor
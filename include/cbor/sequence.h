@@ -0,0 +1,94 @@
+/**
+ * @file   sequence.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/error.h>
+#include <cbor/export.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace cbor {
+
+class sequence_index;
+
+[[nodiscard]] CBOR_EXPORT std::error_code encode(buffer &buf, const sequence_index &v);
+[[nodiscard]] CBOR_EXPORT std::error_code decode(read_buffer &buf, sequence_index &v);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: sequence_index
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Sequence index - sparse random access index for CBOR sequences.
+ *
+ * Records the byte offset of every N-th (stride) item of a CBOR sequence. Seeking to an arbitrary item jumps to the
+ * closest indexed item, and then skips at most `stride - 1` items.
+ *
+ * The index itself is encodable, so it can be stored as a CBOR sidecar next to the sequence. It is encoded as an array
+ * of four elements: the stride, the number of items, the size of the indexed sequence in bytes and an array of
+ * offset deltas between the indexed items.
+ */
+class CBOR_EXPORT sequence_index final {
+public:
+   using offsets_t = std::vector<std::uint64_t>;
+
+   inline static constexpr std::uint64_t default_stride = 1024;
+
+public:
+   explicit sequence_index(std::uint64_t stride = default_stride);
+
+public:
+   /**
+    * (Re-)build the index by scanning the whole sequence once.
+    * @param sequence CBOR sequence to be indexed.
+    * @return Operation result.
+    */
+   [[nodiscard]] std::error_code build(buffer::const_span_t sequence);
+
+   /**
+    * Move the buffer's read position to the start of the specified item.
+    *
+    * The buffer has to hold the same sequence the index was built for. Seeking to the item right after the last one is
+    * allowed, and moves the read position to the end of the buffer.
+    *
+    * @param buf Buffer holding the indexed sequence.
+    * @param item Zero-based item number.
+    * @return Operation result.
+    */
+   [[nodiscard]] std::error_code seek(read_buffer &buf, std::uint64_t item) const;
+
+   /**
+    * Split the indexed sequence into up to `count` contiguous parts of roughly the same number of items.
+    *
+    * Every part starts at an item boundary, and can be decoded independently from the other parts.
+    *
+    * @param sequence The indexed sequence.
+    * @param count Maximal number of parts.
+    * @return Sequence parts (empty if the sequence doesn't match the index).
+    */
+   [[nodiscard]] std::vector<buffer::const_span_t> partition(buffer::const_span_t sequence, std::size_t count) const;
+
+   [[nodiscard]] std::uint64_t stride() const { return stride_; }
+   [[nodiscard]] std::uint64_t item_count() const { return item_count_; }
+   [[nodiscard]] std::uint64_t sequence_size() const { return sequence_size_; }
+
+   //! Offsets of the items 0, stride, 2 * stride, ...
+   [[nodiscard]] const offsets_t &offsets() const { return offsets_; }
+
+private:
+   friend std::error_code encode(buffer &buf, const sequence_index &v);
+   friend std::error_code decode(read_buffer &buf, sequence_index &v);
+
+private:
+   std::uint64_t stride_;
+   std::uint64_t item_count_{0};
+   std::uint64_t sequence_size_{0};
+   offsets_t offsets_{};
+};
+
+} // namespace cbor
@@ -0,0 +1,183 @@
+/**
+ * @file   shared_ring.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/config.h>
+
+#if CBOR_WITH(SHARED_MEMORY)
+
+#include <cbor/buffer.h>
+#include <cbor/error.h>
+#include <cbor/export.h>
+
+#include <cstdint>
+
+namespace cbor {
+
+namespace detail {
+struct ring_control;
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: shared_ring
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Shared ring - lock-free single-producer/single-consumer message ring, placed in shared memory.
+ *
+ * The ring memory is backed by a memfd, which can be passed to another process (e.g. inherited, or sent over a Unix
+ * socket), and attached to there. The data area is mapped twice back-to-back, so every message occupies a contiguous
+ * memory range, even if it wraps around the end of the ring.
+ *
+ * Messages are encoded directly into the ring with a ring_writer, and are handed out to the consumer as views by a
+ * ring_reader, so no copies are made on either side.
+ */
+class CBOR_EXPORT shared_ring final {
+public:
+   shared_ring() = default;
+   ~shared_ring();
+
+   shared_ring(const shared_ring &) = delete;
+   shared_ring(shared_ring &&o) noexcept;
+
+public:
+   shared_ring &operator=(const shared_ring &) = delete;
+   shared_ring &operator=(shared_ring &&o) noexcept;
+
+public:
+   /**
+    * Create a new ring.
+    * @param capacity Minimal ring capacity in bytes, rounded up to a power of two (and at least a page).
+    * @return Operation result (system error code on failure).
+    */
+   [[nodiscard]] std::error_code create(std::size_t capacity);
+
+   /**
+    * Attach to a ring created by another ring instance (possibly in another process).
+    * @param fd File descriptor of the ring, the descriptor is duplicated.
+    * @return Operation result (system error code on failure).
+    */
+   [[nodiscard]] std::error_code attach(int fd);
+
+   void close();
+
+   [[nodiscard]] bool is_open() const { return control_ != nullptr; }
+   [[nodiscard]] int fd() const { return fd_; }
+   [[nodiscard]] std::size_t capacity() const { return capacity_; }
+
+private:
+   [[nodiscard]] std::error_code map(int fd, std::size_t capacity);
+
+private:
+   friend class ring_writer;
+   friend class ring_reader;
+
+   detail::ring_control *control_{nullptr};
+   std::byte *data_{nullptr};
+   std::size_t capacity_{0};
+   int fd_{-1};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: ring_writer
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Ring writer - producer side of a shared ring.
+ *
+ * Everything written into the writer becomes a part of the current message, which is invisible to the consumer until
+ * committed. Running out of ring space results in a buffer_overflow error, leaving the message untouched, so a failed
+ * encoding can either be rolled back or discarded.
+ *
+ * The ring has to be open when the writer is constructed, otherwise writing fails with invalid_usage.
+ */
+class CBOR_EXPORT ring_writer final : public buffer {
+public:
+   explicit ring_writer(shared_ring &ring);
+
+   ring_writer(const ring_writer &) = delete;
+   ring_writer(ring_writer &&) = default;
+
+public:
+   ring_writer &operator=(const ring_writer &) = delete;
+   ring_writer &operator=(ring_writer &&) = default;
+
+public:
+   using buffer::write;
+
+   [[nodiscard]] std::error_code write(const_span_t v) override;
+   [[nodiscard]] std::size_t size() override { return size_; };
+
+   //! Publish the current message to the consumer, and start a new one
+   [[nodiscard]] std::error_code commit();
+
+   //! Drop the current message, and start a new one
+   void discard() { size_ = 0; }
+
+protected:
+   [[nodiscard]] rollback_token_t begin_nested_write() override;
+   void rollback_nested_write(rollback_token_t token) override;
+
+private:
+   //! Number of bytes released by the consumer, ill_formed if the consumer's read position is corrupted
+   [[nodiscard]] std::error_code free_space(std::uint64_t &available) const;
+
+private:
+   shared_ring *ring_;
+   std::uint64_t position_;
+   std::size_t size_{0};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: ring_reader
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Ring reader - consumer side of a shared ring.
+ *
+ * The ring has to be open when the reader is constructed, otherwise peeking fails with invalid_usage.
+ *
+ * @code{.cpp}
+ * cbor::buffer::const_span_t message;
+ * while (!reader.peek(message)) {
+ *    cbor::read_buffer buf{message};
+ *    ...
+ *    reader.release();
+ * }
+ * @endcode
+ */
+class CBOR_EXPORT ring_reader final {
+public:
+   explicit ring_reader(shared_ring &ring);
+
+   ring_reader(const ring_reader &) = delete;
+   ring_reader(ring_reader &&) = default;
+
+public:
+   ring_reader &operator=(const ring_reader &) = delete;
+   ring_reader &operator=(ring_reader &&) = default;
+
+public:
+   /**
+    * Get the oldest unreleased message.
+    *
+    * The message stays valid (and occupies the ring space) until released.
+    *
+    * @param[out] message View of the message.
+    * @return Operation result, buffer_underflow if there are no messages.
+    */
+   [[nodiscard]] std::error_code peek(buffer::const_span_t &message);
+
+   //! Release the message returned by the last successful peek, making its space available to the producer.
+   void release();
+
+private:
+   shared_ring *ring_;
+   std::uint64_t position_;
+   std::uint64_t pending_{0};
+};
+
+} // namespace cbor
+
+#endif // CBOR_WITH(SHARED_MEMORY)
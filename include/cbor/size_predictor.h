@@ -0,0 +1,150 @@
+/**
+ * @file   size_predictor.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/encoding.h>
+#include <cbor/error.h>
+#include <cbor/export.h>
+#include <cbor/schema.h>
+#include <cbor/type_traits.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace cbor {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: size_predictor
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Size predictor - learns the encoded size of top-level message types, and pre-reserves that much before encoding.
+ *
+ * Every type has its own exponentially weighted moving average of the encoded size (and of its deviation). The
+ * predicted size is the average plus twice the deviation, so that stable workloads encode without any reallocations,
+ * while occasional spikes don't inflate the reservation for good.
+ *
+ * Types are keyed by their type ID, if available, or by their schema fingerprint otherwise.
+ *
+ * The predictor is not thread-safe, use one instance per encoding thread.
+ *
+ * @code{.cpp}
+ * cbor::size_predictor predictor{};
+ * std::vector<std::byte> target{};
+ * if (auto res = predictor.encode(target, msg)) { ... }
+ * @endcode
+ */
+class CBOR_EXPORT size_predictor final {
+public:
+   using key_t = std::uint64_t;
+
+   //! Learned statistics of a single type
+   struct statistics {
+      double mean{0};           //! Moving average of the encoded size
+      double deviation{0};      //! Moving average of the absolute deviation from the mean
+      std::size_t last{0};      //! Most recent encoded size
+      std::size_t peak{0};      //! Largest encoded size seen so far
+      std::uint64_t samples{0}; //! Number of recorded sizes
+
+      //! Number of bytes to reserve for the next message
+      [[nodiscard]] std::size_t predicted() const;
+   };
+
+   inline static constexpr double default_weight = 0.125;
+
+   template <typename T>
+   inline static constexpr key_t key_v = [] {
+      using U = std::remove_cvref_t<T>;
+      if constexpr (WithTypeID<U>) {
+         return static_cast<key_t>(type_id_v<U>);
+      } else {
+         return schema_fingerprint_v<U>;
+      }
+   }();
+
+public:
+   /**
+    * @param weight Weight of a new sample in the moving averages, in the (0, 1] range.
+    */
+   explicit size_predictor(double weight = default_weight);
+
+public:
+   //! Record the encoded size of a message
+   void record(key_t key, std::size_t size);
+
+   //! Number of bytes to reserve for the next message, falls back to the dynamic_buffer_initial_size for unknown keys
+   [[nodiscard]] std::size_t predict(key_t key) const;
+
+   [[nodiscard]] std::optional<statistics> stats(key_t key) const;
+
+   //! Learned statistics of all the types
+   [[nodiscard]] const std::unordered_map<key_t, statistics> &all_stats() const { return stats_; }
+
+   void reset() { stats_.clear(); }
+
+   template <typename T>
+   void record(std::size_t size) {
+      record(key_v<T>, size);
+   }
+
+   template <typename T>
+   [[nodiscard]] std::size_t predict() const {
+      return predict(key_v<T>);
+   }
+
+   template <typename T>
+   [[nodiscard]] std::optional<statistics> stats() const {
+      return stats(key_v<T>);
+   }
+
+   /**
+    * Encode a value at the end of the target vector, reserving the predicted size up front.
+    *
+    * The target only grows if the predicted size doesn't fit into the spare capacity, and then at least doubles, so
+    * appending many values to the same vector keeps the amortized constant cost.
+    *
+    * Only the successfully encoded sizes are recorded.
+    *
+    * @param target Vector to append the encoded value to.
+    * @param v Value to be encoded.
+    * @param max_capacity Capacity limit of the target vector.
+    * @return Operation result.
+    */
+   template <typename T>
+   [[nodiscard]] std::error_code encode(std::vector<std::byte> &target,
+                                        const T &v,
+                                        std::size_t max_capacity = buffer::unlimited_capacity) {
+      const auto start = target.size();
+      const auto predicted = predict<T>();
+      if (target.capacity() - start < predicted) {
+         auto expected = std::max(start + predicted, 2 * target.capacity());
+         if (max_capacity != buffer::unlimited_capacity) {
+            expected = std::min(expected, max_capacity);
+         }
+         target.reserve(expected);
+      }
+
+      dynamic_buffer buf{target, max_capacity};
+      auto res = cbor::encode(buf, v);
+      if (res) {
+         return res;
+      }
+
+      record<T>(target.size() - start);
+      return error::success;
+   }
+
+private:
+   double weight_;
+   std::unordered_map<key_t, statistics> stats_{};
+};
+
+} // namespace cbor
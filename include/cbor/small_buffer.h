@@ -0,0 +1,135 @@
+/**
+ * @file   small_buffer.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/error.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace cbor {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: small_buffer
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Small buffer - owning buffer, that keeps up to N bytes inline and only spills to the heap when exceeded.
+ *
+ * Encoding a message that fits into the inline storage doesn't allocate at all. Once spilled, the buffer stays on the
+ * heap (until released), so the allocated capacity is reused after a clear().
+ *
+ * @code{.cpp}
+ * cbor::small_buffer<256> buf{};
+ * if (auto res = cbor::encode(buf, msg)) { ... }
+ * socket.send(buf.bytes());
+ * @endcode
+ *
+ * @tparam N Inline capacity in bytes.
+ */
+template <std::size_t N>
+class small_buffer final : public buffer {
+public:
+   using vector_t = std::vector<std::byte>;
+
+public:
+   explicit small_buffer(std::size_t max_capacity = buffer::unlimited_capacity)
+      : max_capacity_{max_capacity} {
+      // Nothing to do here
+   }
+
+   small_buffer(const small_buffer &) = delete;
+   small_buffer(small_buffer &&) = default;
+
+public:
+   small_buffer &operator=(const small_buffer &) = delete;
+   small_buffer &operator=(small_buffer &&) = default;
+
+public:
+   using buffer::write;
+
+   [[nodiscard]] std::error_code write(const_span_t v) override {
+      const auto current = size();
+      if (max_capacity_ != buffer::unlimited_capacity && v.size() > max_capacity_ - current) {
+         return error::buffer_overflow;
+      }
+
+      if (!spilled_) {
+         if (v.size() <= N - inline_size_) {
+            std::ranges::copy(v, inline_.begin() + inline_size_);
+            inline_size_ += v.size();
+            return error::success;
+         }
+
+         // Spill to the heap, leaving some room for further writes
+         heap_.reserve(std::max(N * 2, current + v.size()));
+         heap_.assign(inline_.begin(), inline_.begin() + inline_size_);
+         spilled_ = true;
+      }
+
+      heap_.insert(heap_.end(), v.begin(), v.end());
+      return error::success;
+   }
+
+   [[nodiscard]] std::size_t size() override { return spilled_ ? heap_.size() : inline_size_; }
+
+public:
+   //! Encoded bytes, valid until the next modification
+   [[nodiscard]] const_span_t bytes() const {
+      return spilled_ ? const_span_t{heap_} : const_span_t{inline_.data(), inline_size_};
+   }
+
+   //! True if the contents are kept in the inline storage
+   [[nodiscard]] bool is_inline() const { return !spilled_; }
+
+   void clear() {
+      inline_size_ = 0;
+      heap_.clear();
+   }
+
+   /**
+    * Hand out the contents, leaving the buffer empty.
+    *
+    * Heap-backed contents are moved out without copying, inline contents are copied into a new vector.
+    */
+   [[nodiscard]] vector_t release() {
+      vector_t result{};
+      if (spilled_) {
+         result = std::move(heap_);
+         heap_ = {};
+         spilled_ = false;
+      } else {
+         result.assign(inline_.begin(), inline_.begin() + inline_size_);
+      }
+
+      inline_size_ = 0;
+      return result;
+   }
+
+protected:
+   [[nodiscard]] rollback_token_t begin_nested_write() override { return static_cast<rollback_token_t>(size()); }
+
+   void rollback_nested_write(rollback_token_t token) override {
+      // Rolled back contents stay on the heap, if already spilled
+      if (spilled_) {
+         heap_.resize(static_cast<std::size_t>(token));
+      } else {
+         inline_size_ = static_cast<std::size_t>(token);
+      }
+   }
+
+private:
+   std::array<std::byte, N> inline_{};
+   std::size_t inline_size_{0};
+   vector_t heap_{};
+   bool spilled_{false};
+   std::size_t max_capacity_;
+};
+
+} // namespace cbor
@@ -0,0 +1,167 @@
+/**
+ * @file   static_vector.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/buffer.h>
+#include <cbor/decoding.h>
+#include <cbor/encoding.h>
+#include <cbor/error.h>
+#include <cbor/type_traits.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace cbor {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: static_vector
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Fixed-capacity vector - stores up to N elements inline, without any heap allocations.
+ *
+ * Has the same encoding as std::vector (including the byte string encoding for the byte types), so both types can be
+ * used interchangeably on the different sides of a connection. Decoding an array with more than N elements fails with
+ * error::buffer_overflow.
+ *
+ * All N elements are always constructed, so T has to be default-constructible, and the elements past size() keep their
+ * values until overwritten.
+ *
+ * @code{.cpp}
+ * struct order_book {
+ *    cbor::static_vector<level, 16> bids;
+ *    cbor::static_vector<level, 16> asks;
+ * };
+ * @endcode
+ */
+template <typename T, std::size_t N>
+class static_vector {
+public:
+   using value_type = T;
+   using size_type = std::size_t;
+   using iterator = T *;
+   using const_iterator = const T *;
+
+public:
+   constexpr static_vector() = default;
+
+public:
+   /**
+    * Append an element.
+    * @param v Element to be appended.
+    * @return Operation result, buffer_overflow if the vector is full.
+    */
+   [[nodiscard]] std::error_code push_back(T v) {
+      if (size_ == N) {
+         return error::buffer_overflow;
+      }
+
+      data_[size_++] = std::move(v);
+      return error::success;
+   }
+
+   /**
+    * Change the number of elements. New elements are reset to their default value.
+    * @param size New number of elements.
+    * @return Operation result, buffer_overflow if the size exceeds the capacity.
+    */
+   [[nodiscard]] std::error_code resize(std::size_t size) {
+      if (size > N) {
+         return error::buffer_overflow;
+      }
+
+      for (std::size_t i = size_; i < size; ++i) {
+         data_[i] = T{};
+      }
+
+      size_ = size;
+      return error::success;
+   }
+
+   constexpr void clear() { size_ = 0; }
+
+   [[nodiscard]] constexpr T &operator[](std::size_t idx) { return data_[idx]; }
+   [[nodiscard]] constexpr const T &operator[](std::size_t idx) const { return data_[idx]; }
+
+   [[nodiscard]] constexpr T *data() { return data_.data(); }
+   [[nodiscard]] constexpr const T *data() const { return data_.data(); }
+   [[nodiscard]] constexpr std::size_t size() const { return size_; }
+   [[nodiscard]] constexpr bool empty() const { return size_ == 0; }
+   [[nodiscard]] static constexpr std::size_t capacity() { return N; }
+
+   [[nodiscard]] constexpr iterator begin() { return data_.data(); }
+   [[nodiscard]] constexpr iterator end() { return data_.data() + size_; }
+   [[nodiscard]] constexpr const_iterator begin() const { return data_.data(); }
+   [[nodiscard]] constexpr const_iterator end() const { return data_.data() + size_; }
+
+   [[nodiscard]] constexpr std::span<const T> span() const { return {data_.data(), size_}; }
+
+   [[nodiscard]] friend constexpr bool operator==(const static_vector &lhs, const static_vector &rhs) {
+      return std::ranges::equal(lhs.span(), rhs.span());
+   }
+
+private:
+   template <typename U, std::size_t M>
+      requires Decodable<U>
+   friend std::error_code decode(read_buffer &buf, static_vector<U, M> &v);
+
+   std::array<T, N> data_{};
+   std::size_t size_{0};
+};
+
+template <typename T, std::size_t N>
+   requires Encodable<T>
+[[nodiscard]] std::error_code encode(buffer &buf, const static_vector<T, N> &v) {
+   return encode(buf, v.span());
+}
+
+template <typename T, std::size_t N>
+   requires Decodable<T>
+[[nodiscard]] std::error_code decode(read_buffer &buf, static_vector<T, N> &v) {
+   if constexpr (IsByte<T>) {
+      static_assert(sizeof(T) == sizeof(std::byte));
+
+      std::size_t size{0};
+      auto res = decode(buf, buffer::span_t{reinterpret_cast<std::byte *>(v.data()), N}, size);
+      if (res) {
+         return res;
+      }
+
+      v.size_ = size;
+      return error::success;
+   } else {
+      detail::head head{};
+      auto res = head.read(buf);
+      if (res) {
+         return res;
+      }
+
+      if (head.type != major_type::array) {
+         return error::unexpected_type;
+      }
+
+      const auto u64 = head.decode_argument();
+      if (u64 > N) {
+         return error::buffer_overflow;
+      }
+
+      v.size_ = static_cast<std::size_t>(u64);
+      for (std::size_t i = 0; i < v.size_; ++i) {
+         res = decode(buf, v.data_[i]);
+         if (res) {
+            return res;
+         }
+      }
+
+      return error::success;
+   }
+}
+
+} // namespace cbor
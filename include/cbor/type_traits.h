@@ -11,6 +11,7 @@
 #include <cstdint>
 #include <limits>
 #include <ranges>
+#include <tuple>
 #include <type_traits>
 
 #if CBOR_WITH(BOOST_PFR)
@@ -70,6 +71,55 @@ struct type_id;
 template <typename T>
 inline constexpr auto type_id_v = type_id<std::remove_cvref_t<T>>::value;
 
+/**
+ * Tagged variant trait.
+ *
+ * By default variants are encoded as an array of two elements: [type_id, value]. When specialized to std::true_type
+ * for a variant type, its alternatives are encoded as a CBOR tag instead, using the type ID as the tag number. This
+ * saves a byte per value, and allows generic tools to recognize the alternatives without knowing the variant type.
+ *
+ * Type IDs of the tagged variant alternatives have to be non-negative, and should not collide with the registered
+ * CBOR tags, if the encoding is ever processed by third-party tools.
+ * @example
+ * @code{.cpp}
+ * using message_t = std::variant<foo, bar>;
+ *
+ * namespace cbor {
+ * template &lt;&gt;
+ * struct is_tagged_variant&lt;message_t&gt; : std::true_type {};
+ * };
+ * @endcode
+ */
+template <typename T>
+struct is_tagged_variant : std::false_type {};
+
+template <typename T>
+inline constexpr bool is_tagged_variant_v = is_tagged_variant<std::remove_cvref_t<T>>::value;
+
+/**
+ * Columnar encoding trait.
+ *
+ * By default vectors of structs are encoded row by row: as an array of structs. When specialized to std::true_type for
+ * a struct type, vectors of that struct are encoded column by column instead: as an array with one column per member,
+ * each holding the member values of all the elements. Integer and floating-point columns are encoded as RFC 8746 typed
+ * arrays (little endian), which compress well and can be processed in bulk without decoding the individual values.
+ *
+ * The columnar encoding can also be decoded directly into a struct of vectors, see decode_columns(). Only std::vector
+ * is affected, fixed-size arrays and spans of the struct are still encoded row by row.
+ * @example
+ * @code{.cpp}
+ * namespace cbor {
+ * template &lt;&gt;
+ * struct is_columnar&lt;contact&gt; : std::true_type {};
+ * };
+ * @endcode
+ */
+template <typename T>
+struct is_columnar : std::false_type {};
+
+template <typename T>
+inline constexpr bool is_columnar_v = is_columnar<std::remove_cvref_t<T>>::value;
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Concepts
 ////////////////////////////////////////////////////////////////////////////////
@@ -102,6 +152,31 @@ concept Int = UnsignedInt<T> || SignedInt<T>;
 template <typename T>
 concept Enum = std::is_enum_v<T>;
 
+template <typename T>
+concept Char = std::is_same_v<std::remove_cv_t<T>, char> || std::is_same_v<std::remove_cv_t<T>, wchar_t> ||
+               std::is_same_v<std::remove_cv_t<T>, char8_t> || std::is_same_v<std::remove_cv_t<T>, char16_t> ||
+               std::is_same_v<std::remove_cv_t<T>, char32_t>;
+
+//! Integer and floating-point types, that can be stored in the RFC 8746 typed arrays
+template <typename T>
+concept TypedArrayElement = (Int<T> && !Char<T>) || std::is_same_v<std::remove_cv_t<T>, float> ||
+                            std::is_same_v<std::remove_cv_t<T>, double>;
+
+/**
+ * Byte trait.
+ *
+ * Contiguous ranges (std::vector, std::array, std::span) of byte types are encoded as a single CBOR byte string,
+ * instead of an array with one head per element. Only std::byte is a byte type by default, because changing the
+ * encoding of existing std::uint8_t or char ranges would break the compatibility with already deployed peers. Other
+ * single-byte types can opt-in by specializing this trait.
+ * @example
+ * @code{.cpp}
+ * namespace cbor {
+ * template &lt;&gt;
+ * struct is_byte&lt;std::uint8_t&gt; : std::bool_constant&lt;true&gt; {};
+ * };
+ * @endcode
+ */
 template <typename T>
 struct is_byte : std::bool_constant<false> {};
 
@@ -136,9 +211,59 @@ concept Dictionary = AssociativeContainer<T> && requires(T &v) {
 ////////////////////////////////////////////////////////////////////////////////
 /// Structs
 ////////////////////////////////////////////////////////////////////////////////
-//! Treat structs with either a type_id specialization, or explicitly enabled CBOR encoding as whitelisted.
+/**
+ * Register the encoded members of a struct or a class, in the encoding order.
+ *
+ * Has to be placed inside the type definition. Unlike Boost PFR, the registered members may be private and may come
+ * from the base classes, so any class type can be registered, not just aggregates. The registration also whitelists
+ * the type for encoding, and takes precedence over Boost PFR, which is not instantiated for the registered types.
+ * Derived classes don't inherit the registration of their bases.
+ * @example
+ * @code{.cpp}
+ * class contact : public entity {
+ * public:
+ *    ...
+ *
+ * private:
+ *    CBOR_FIELDS(contact, id_, name_, phone_)
+ *
+ *    std::string name_;
+ *    std::optional<std::string> phone_;
+ * };
+ * @endcode
+ */
+#define CBOR_FIELDS(T, ...)                                                  \
+   friend struct ::cbor::field_access;                                       \
+   using cbor_fields_owner_t = T;                                            \
+   constexpr auto cbor_fields() const { return std::tie(__VA_ARGS__); }      \
+   constexpr auto cbor_fields() { return std::tie(__VA_ARGS__); }
+
+//! Access to the members registered with CBOR_FIELDS, which are usually private.
+struct field_access {
+   template <typename T>
+   [[nodiscard]] static consteval bool is_registered() {
+      if constexpr (requires { typename T::cbor_fields_owner_t; }) {
+         return std::is_same_v<typename T::cbor_fields_owner_t, T>;
+      } else {
+         return false;
+      }
+   }
+
+   //! Tuple of references to the registered members
+   template <typename T>
+   [[nodiscard]] static constexpr auto members(T &v) {
+      return v.cbor_fields();
+   }
+};
+
+template <typename T>
+concept WithFieldTable = std::is_class_v<T> && field_access::is_registered<T>();
+
+//! Treat structs with either a type_id specialization, registered fields, or explicitly enabled CBOR encoding as
+//! whitelisted.
 template <typename T>
-concept WhitelistedStruct = std::is_class_v<T> && (WithTypeID<T> || requires(T e) { enable_cbor_encoding(e); });
+concept WhitelistedStruct =
+   std::is_class_v<T> && (WithTypeID<T> || WithFieldTable<T> || requires(T e) { enable_cbor_encoding(e); });
 
 #if CBOR_WITH(BOOST_PFR)
 template <WhitelistedStruct T>
@@ -147,12 +272,12 @@ template <WhitelistedStruct T>
 }
 
 template <std::size_t Idx, WhitelistedStruct T>
-[[nodiscard]] const auto &get_member(const T &v) {
+[[nodiscard]] constexpr const auto &get_member(const T &v) {
    return boost::pfr::get<Idx>(v);
 }
 
 template <std::size_t Idx, WhitelistedStruct T>
-[[nodiscard]] auto &get_member_non_const(T &v) {
+[[nodiscard]] constexpr auto &get_member_non_const(T &v) {
    return boost::pfr::get<Idx>(v);
 }
 #else
@@ -160,12 +285,35 @@ template <WhitelistedStruct T>
 [[nodiscard]] consteval std::size_t get_member_count();
 
 template <std::size_t Idx, WhitelistedStruct T>
-[[nodiscard]] const auto &get_member(const T &v);
+[[nodiscard]] constexpr const auto &get_member(const T &v);
 
 template <std::size_t Idx, WhitelistedStruct T>
-[[nodiscard]] auto &get_member_non_const(T &v);
+[[nodiscard]] constexpr auto &get_member_non_const(T &v);
 #endif // CBOR_WITH(BOOST_PFR)
 
+// Registered fields are more constrained than the generic overloads above, so they always take precedence
+template <WhitelistedStruct T>
+   requires WithFieldTable<T>
+[[nodiscard]] consteval std::size_t get_member_count() {
+   return std::tuple_size_v<decltype(field_access::members(std::declval<const T &>()))>;
+}
+
+template <std::size_t Idx, WhitelistedStruct T>
+   requires WithFieldTable<T>
+[[nodiscard]] constexpr const auto &get_member(const T &v) {
+   return std::get<Idx>(field_access::members(v));
+}
+
+template <std::size_t Idx, WhitelistedStruct T>
+   requires WithFieldTable<T>
+[[nodiscard]] constexpr auto &get_member_non_const(T &v) {
+   return std::get<Idx>(field_access::members(v));
+}
+
+//! Type of a struct member, as returned by get_member
+template <typename T, std::size_t Idx>
+using member_type_t = std::remove_cvref_t<decltype(get_member<Idx>(std::declval<const T &>()))>;
+
 template <typename T>
 concept EncodableStruct = WhitelistedStruct<T> && requires(const T &t) {
    { get_member_count<T>() } -> std::same_as<std::size_t>;
@@ -0,0 +1,299 @@
+/**
+ * @file   cpu_dispatch.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <cbor/cpu_dispatch.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdlib>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CBOR_X86_DISPATCH 1
+#include <immintrin.h>
+#else
+#define CBOR_X86_DISPATCH 0
+#endif
+
+namespace cbor::cpu {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Baseline kernels
+////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T max_scalar(const T *v, std::size_t size) {
+   T result = 0;
+   for (std::size_t i = 0; i < size; ++i) {
+      result = std::max(result, v[i]);
+   }
+   return result;
+}
+
+// Clearing bit 5 maps the negative integers (major type 1) onto the unsigned ones (major type 0)
+constexpr std::uint8_t small_int_mask = 0xDF;
+
+//! Largest initial byte of an unsigned integer without extra bytes
+constexpr std::uint8_t small_int_limit = 0x17;
+
+std::size_t small_int_run_scalar(const std::uint8_t *v, std::size_t size) {
+   std::size_t i = 0;
+   while (i < size && (v[i] & small_int_mask) <= small_int_limit) {
+      ++i;
+   }
+   return i;
+}
+
+constexpr kernels baseline_kernels{
+   .tier = level::baseline,
+   .max_u8 = max_scalar<std::uint8_t>,
+   .max_u16 = max_scalar<std::uint16_t>,
+   .max_u32 = max_scalar<std::uint32_t>,
+   .max_u64 = max_scalar<std::uint64_t>,
+   .small_int_run = small_int_run_scalar,
+};
+
+#if CBOR_X86_DISPATCH
+////////////////////////////////////////////////////////////////////////////////
+/// x86 kernels
+////////////////////////////////////////////////////////////////////////////////
+// Every kernel has to be compiled with its own target attribute, otherwise the intrinsics can't be inlined into it, so
+// the kernels are stamped out with a macro instead of a template: accumulate the lane-wise maximum over whole vectors,
+// then reduce the lanes and the remaining tail with the scalar code.
+#define CBOR_MAX_KERNEL(NAME, TARGET, T, VEC, ZERO, LOAD, STORE, MAX)            \
+   __attribute__((target(TARGET))) T NAME(const T *v, std::size_t size) {       \
+      constexpr std::size_t lanes = sizeof(VEC) / sizeof(T);                     \
+      VEC acc = ZERO();                                                          \
+      std::size_t i = 0;                                                         \
+      for (; i + lanes <= size; i += lanes) {                                    \
+         acc = MAX(acc, LOAD(reinterpret_cast<const VEC *>(v + i)));             \
+      }                                                                          \
+      std::array<T, lanes> reduced{};                                            \
+      STORE(reinterpret_cast<VEC *>(reduced.data()), acc);                       \
+      const auto head = max_scalar(reduced.data(), lanes);                       \
+      return std::max(head, max_scalar(v + i, size - i));                        \
+   }
+
+// There is no unsigned 64-bit maximum before AVX-512: flip the sign bits and use the signed comparison instead
+__attribute__((target("sse4.2"))) __m128i max_epu64_sse42(__m128i a, __m128i b) {
+   const auto bias = _mm_set1_epi64x(static_cast<long long>(0x8000000000000000ULL));
+   const auto a_greater = _mm_cmpgt_epi64(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+   return _mm_blendv_epi8(b, a, a_greater);
+}
+
+__attribute__((target("avx2"))) __m256i max_epu64_avx2(__m256i a, __m256i b) {
+   const auto bias = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ULL));
+   const auto a_greater = _mm256_cmpgt_epi64(_mm256_xor_si256(a, bias), _mm256_xor_si256(b, bias));
+   return _mm256_blendv_epi8(b, a, a_greater);
+}
+
+// clang-format off
+CBOR_MAX_KERNEL(max_u8_sse42, "sse4.2", std::uint8_t, __m128i, _mm_setzero_si128, _mm_loadu_si128, _mm_storeu_si128, _mm_max_epu8)
+CBOR_MAX_KERNEL(max_u16_sse42, "sse4.2", std::uint16_t, __m128i, _mm_setzero_si128, _mm_loadu_si128, _mm_storeu_si128, _mm_max_epu16)
+CBOR_MAX_KERNEL(max_u32_sse42, "sse4.2", std::uint32_t, __m128i, _mm_setzero_si128, _mm_loadu_si128, _mm_storeu_si128, _mm_max_epu32)
+CBOR_MAX_KERNEL(max_u64_sse42, "sse4.2", std::uint64_t, __m128i, _mm_setzero_si128, _mm_loadu_si128, _mm_storeu_si128, max_epu64_sse42)
+
+CBOR_MAX_KERNEL(max_u8_avx2, "avx2", std::uint8_t, __m256i, _mm256_setzero_si256, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_max_epu8)
+CBOR_MAX_KERNEL(max_u16_avx2, "avx2", std::uint16_t, __m256i, _mm256_setzero_si256, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_max_epu16)
+CBOR_MAX_KERNEL(max_u32_avx2, "avx2", std::uint32_t, __m256i, _mm256_setzero_si256, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_max_epu32)
+CBOR_MAX_KERNEL(max_u64_avx2, "avx2", std::uint64_t, __m256i, _mm256_setzero_si256, _mm256_loadu_si256, _mm256_storeu_si256, max_epu64_avx2)
+
+CBOR_MAX_KERNEL(max_u8_avx512, "avx512f,avx512bw", std::uint8_t, __m512i, _mm512_setzero_si512, _mm512_loadu_si512, _mm512_storeu_si512, _mm512_max_epu8)
+CBOR_MAX_KERNEL(max_u16_avx512, "avx512f,avx512bw", std::uint16_t, __m512i, _mm512_setzero_si512, _mm512_loadu_si512, _mm512_storeu_si512, _mm512_max_epu16)
+CBOR_MAX_KERNEL(max_u32_avx512, "avx512f,avx512bw", std::uint32_t, __m512i, _mm512_setzero_si512, _mm512_loadu_si512, _mm512_storeu_si512, _mm512_max_epu32)
+CBOR_MAX_KERNEL(max_u64_avx512, "avx512f,avx512bw", std::uint64_t, __m512i, _mm512_setzero_si512, _mm512_loadu_si512, _mm512_storeu_si512, _mm512_max_epu64)
+// clang-format on
+
+#undef CBOR_MAX_KERNEL
+
+// Small integer runs: mask every byte, compare it against the limit, and stop at the first lane that fails
+__attribute__((target("sse4.2"))) std::size_t small_int_run_sse42(const std::uint8_t *v, std::size_t size) {
+   const auto mask = _mm_set1_epi8(static_cast<char>(small_int_mask));
+   const auto limit = _mm_set1_epi8(static_cast<char>(small_int_limit));
+
+   std::size_t i = 0;
+   for (; i + 16 <= size; i += 16) {
+      const auto masked = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(v + i)), mask);
+      const auto small = _mm_cmpeq_epi8(_mm_min_epu8(masked, limit), masked);
+      const auto bits = static_cast<std::uint32_t>(_mm_movemask_epi8(small));
+      if (bits != 0xFFFF) {
+         return i + static_cast<std::size_t>(std::countr_one(bits));
+      }
+   }
+   return i + small_int_run_scalar(v + i, size - i);
+}
+
+__attribute__((target("avx2"))) std::size_t small_int_run_avx2(const std::uint8_t *v, std::size_t size) {
+   const auto mask = _mm256_set1_epi8(static_cast<char>(small_int_mask));
+   const auto limit = _mm256_set1_epi8(static_cast<char>(small_int_limit));
+
+   std::size_t i = 0;
+   for (; i + 32 <= size; i += 32) {
+      const auto masked = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(v + i)), mask);
+      const auto small = _mm256_cmpeq_epi8(_mm256_min_epu8(masked, limit), masked);
+      const auto bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(small));
+      if (bits != 0xFFFFFFFF) {
+         return i + static_cast<std::size_t>(std::countr_one(bits));
+      }
+   }
+   return i + small_int_run_scalar(v + i, size - i);
+}
+
+__attribute__((target("avx512f,avx512bw"))) std::size_t small_int_run_avx512(const std::uint8_t *v, std::size_t size) {
+   const auto mask = _mm512_set1_epi8(static_cast<char>(small_int_mask));
+   const auto limit = _mm512_set1_epi8(static_cast<char>(small_int_limit));
+
+   std::size_t i = 0;
+   for (; i + 64 <= size; i += 64) {
+      const auto masked = _mm512_and_si512(_mm512_loadu_si512(v + i), mask);
+      const auto bits = static_cast<std::uint64_t>(_mm512_cmple_epu8_mask(masked, limit));
+      if (bits != ~std::uint64_t{0}) {
+         return i + static_cast<std::size_t>(std::countr_one(bits));
+      }
+   }
+   return i + small_int_run_scalar(v + i, size - i);
+}
+
+constexpr kernels sse42_kernels{
+   .tier = level::sse4_2,
+   .max_u8 = max_u8_sse42,
+   .max_u16 = max_u16_sse42,
+   .max_u32 = max_u32_sse42,
+   .max_u64 = max_u64_sse42,
+   .small_int_run = small_int_run_sse42,
+};
+
+constexpr kernels avx2_kernels{
+   .tier = level::avx2,
+   .max_u8 = max_u8_avx2,
+   .max_u16 = max_u16_avx2,
+   .max_u32 = max_u32_avx2,
+   .max_u64 = max_u64_avx2,
+   .small_int_run = small_int_run_avx2,
+};
+
+constexpr kernels avx512_kernels{
+   .tier = level::avx512,
+   .max_u8 = max_u8_avx512,
+   .max_u16 = max_u16_avx512,
+   .max_u32 = max_u32_avx512,
+   .max_u64 = max_u64_avx512,
+   .small_int_run = small_int_run_avx512,
+};
+#endif // CBOR_X86_DISPATCH
+
+features detect_features() {
+   features result{};
+
+#if CBOR_X86_DISPATCH
+   // Also checks whether the OS preserves the extended registers
+   __builtin_cpu_init();
+   result.sse4_2 = __builtin_cpu_supports("sse4.2");
+   result.avx2 = __builtin_cpu_supports("avx2");
+   result.avx512f = __builtin_cpu_supports("avx512f");
+   result.avx512bw = __builtin_cpu_supports("avx512bw");
+#endif
+
+   return result;
+}
+
+level detect_active_level() {
+   const auto detected = detected_level();
+
+   const char *requested_name = std::getenv("CBOR_CPU_LEVEL");
+   if (!requested_name) {
+      return detected;
+   }
+
+   // Unknown names are ignored
+   const auto requested = parse_level(requested_name);
+   if (!requested) {
+      return detected;
+   }
+
+   return std::min(*requested, detected);
+}
+
+} // namespace
+
+std::string_view to_string(level l) {
+   switch (l) {
+      case level::baseline:
+         return "baseline";
+      case level::sse4_2:
+         return "sse4.2";
+      case level::avx2:
+         return "avx2";
+      case level::avx512:
+         return "avx512";
+   }
+
+   return "unknown";
+}
+
+std::optional<level> parse_level(std::string_view name) {
+   for (const auto l : {level::baseline, level::sse4_2, level::avx2, level::avx512}) {
+      if (name == to_string(l)) {
+         return l;
+      }
+   }
+
+   return std::nullopt;
+}
+
+const features &detected_features() {
+   static const features instance = detect_features();
+   return instance;
+}
+
+level detected_level() {
+   const auto &f = detected_features();
+   if (f.avx512f && f.avx512bw) {
+      return level::avx512;
+   }
+
+   if (f.avx2) {
+      return level::avx2;
+   }
+
+   if (f.sse4_2) {
+      return level::sse4_2;
+   }
+
+   return level::baseline;
+}
+
+level active_level() {
+   static const level instance = detect_active_level();
+   return instance;
+}
+
+const kernels &kernels_for(level l) {
+#if CBOR_X86_DISPATCH
+   switch (std::min(l, detected_level())) {
+      case level::avx512:
+         return avx512_kernels;
+      case level::avx2:
+         return avx2_kernels;
+      case level::sse4_2:
+         return sse42_kernels;
+      case level::baseline:
+         break;
+   }
+#else
+   (void)l;
+#endif
+
+   return baseline_kernels;
+}
+
+const kernels &active_kernels() {
+   static const kernels &instance = kernels_for(active_level());
+   return instance;
+}
+
+} // namespace cbor::cpu
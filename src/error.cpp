@@ -49,6 +49,9 @@ std::string cbor_error_category::message(int ev) const {
       case error::ill_formed:
          return "encoded byte-sequence is ill-formed";
 
+      case error::not_found:
+         return "requested data item is not present";
+
       default:
          return "(unrecognized error)";
    }
@@ -0,0 +1,262 @@
+/**
+ * @file   field_update.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <cbor/decoding.h>
+#include <cbor/field_update.h>
+
+#include <algorithm>
+
+namespace {
+
+using namespace cbor;
+
+//! Read the head of a container, skipping any tags in front of it
+std::error_code read_container_head(read_buffer &buf, detail::head &head) {
+   do {
+      auto res = head.read(buf);
+      if (res) {
+         return res;
+      }
+   } while (head.type == major_type::tag);
+
+   if (head.is_indefinite()) {
+      // Indefinite-length items are not supported by this library
+      return error::decoding_error;
+   }
+
+   return error::success;
+}
+
+//! Consume a map key, checking whether it matches the path element
+std::error_code match_key(read_buffer &buf, const path_element &element, bool &matches) {
+   matches = false;
+
+   const auto start = buf.read_position();
+
+   detail::head head{};
+   auto res = head.read(buf);
+   if (res) {
+      return res;
+   }
+
+   const auto argument = head.decode_argument();
+
+   if (element.get_kind() == path_element::kind::text_key && head.type == major_type::text_string
+       && !head.is_indefinite()) {
+      const auto key = element.text_key();
+      if (argument == key.size()) {
+         const auto remaining = buf.size() - static_cast<std::size_t>(buf.read_position());
+         if (key.size() > remaining) {
+            return error::buffer_underflow;
+         }
+
+         const auto bytes = buf.span().subspan(static_cast<std::size_t>(buf.read_position()), key.size());
+         matches = std::ranges::equal(bytes, key, [](std::byte lhs, char rhs) { return lhs == std::byte(rhs); });
+      }
+
+      return buf.skip(argument);
+   }
+
+   if (element.get_kind() == path_element::kind::int_key
+       && (head.type == major_type::unsigned_int || head.type == major_type::signed_int) && !head.is_indefinite()) {
+      const auto key = element.int_key();
+      if (head.type == major_type::unsigned_int) {
+         matches = key >= 0 && argument == static_cast<std::uint64_t>(key);
+      } else {
+         // Negative integers are encoded as -1 - n
+         matches = key < 0 && argument == static_cast<std::uint64_t>(-(key + 1));
+      }
+      return error::success;
+   }
+
+   // Not comparable with the path element
+   buf.reset(start);
+   return skip(buf);
+}
+
+std::error_code step_into(read_buffer &buf, const path_element &element) {
+   detail::head head{};
+   auto res = read_container_head(buf, head);
+   if (res) {
+      return res;
+   }
+
+   const auto count = head.decode_argument();
+
+   if (element.get_kind() == path_element::kind::index) {
+      if (head.type != major_type::array) {
+         return error::unexpected_type;
+      }
+
+      if (element.index() >= count) {
+         return error::not_found;
+      }
+
+      for (std::uint64_t i = 0; i < element.index(); ++i) {
+         res = skip(buf);
+         if (res) {
+            return res;
+         }
+      }
+
+      return error::success;
+   }
+
+   if (head.type != major_type::dictionary) {
+      return error::unexpected_type;
+   }
+
+   for (std::uint64_t i = 0; i < count; ++i) {
+      bool matches{false};
+      res = match_key(buf, element, matches);
+      if (res) {
+         return res;
+      }
+
+      if (matches) {
+         return error::success;
+      }
+
+      res = skip(buf);
+      if (res) {
+         return res;
+      }
+   }
+
+   return error::not_found;
+}
+
+std::error_code write_head(buffer::span_t target, major_type type, std::uint64_t argument, std::uint8_t extra_bytes) {
+   static_buffer buf{target};
+
+   switch (extra_bytes) {
+      case 1:
+         return detail::encode_argument(buf, type, static_cast<std::uint8_t>(argument), false);
+      case 2:
+         return detail::encode_argument(buf, type, static_cast<std::uint16_t>(argument), false);
+      case 4:
+         return detail::encode_argument(buf, type, static_cast<std::uint32_t>(argument), false);
+      case 8:
+         return detail::encode_argument(buf, type, argument, false);
+      default:
+         return error::invalid_usage;
+   }
+}
+
+} // namespace
+
+namespace cbor {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: path_element
+////////////////////////////////////////////////////////////////////////////////
+path_element path_element::int_key(std::int64_t key) {
+   path_element result{};
+   result.kind_ = kind::int_key;
+   result.int_key_ = key;
+   return result;
+}
+
+std::error_code locate(buffer::const_span_t data, path_t path, field_location &location) {
+   read_buffer buf{data};
+
+   for (const auto &element : path) {
+      auto res = step_into(buf, element);
+      if (res) {
+         return res;
+      }
+   }
+
+   const auto start = buf.read_position();
+   auto res = skip(buf);
+   if (res) {
+      return res;
+   }
+
+   location.offset = static_cast<std::size_t>(start);
+   location.size = static_cast<std::size_t>(buf.read_position() - start);
+   return error::success;
+}
+
+namespace detail {
+
+std::error_code overwrite(buffer::span_t data, const field_location &location, buffer::const_span_t item) {
+   if (location.offset > data.size() || location.size > data.size() - location.offset) {
+      return error::invalid_usage;
+   }
+
+   auto target = data.subspan(location.offset, location.size);
+   if (item.size() == target.size()) {
+      std::ranges::copy(item, target.begin());
+      return error::success;
+   }
+
+   // Try keeping the existing head width
+   read_buffer old_buf{target};
+   head old_head{};
+   auto res = old_head.read(old_buf);
+   if (res) {
+      return res;
+   }
+
+   read_buffer new_buf{item};
+   head new_head{};
+   res = new_head.read(new_buf);
+   if (res) {
+      return res;
+   }
+
+   // The argument of a float is its value, so the width can't be changed
+   const auto resizable = [](const head &h) {
+      return h.type != major_type::simple && !h.is_indefinite();
+   };
+
+   if (!resizable(old_head) || !resizable(new_head) || old_head.extra_bytes == 0
+       || new_head.extra_bytes > old_head.extra_bytes) {
+      return error::value_not_representable;
+   }
+
+   const auto old_head_size = static_cast<std::size_t>(old_buf.read_position());
+   const auto new_head_size = static_cast<std::size_t>(new_buf.read_position());
+   const auto payload = item.subspan(new_head_size);
+   if (old_head_size + payload.size() != target.size()) {
+      return error::value_not_representable;
+   }
+
+   res = write_head(target.first(old_head_size), new_head.type, new_head.decode_argument(), old_head.extra_bytes);
+   if (res) {
+      return res;
+   }
+
+   std::ranges::copy(payload, target.begin() + static_cast<std::ptrdiff_t>(old_head_size));
+   return error::success;
+}
+
+std::error_code splice(std::vector<std::byte> &data, const field_location &location, buffer::const_span_t item) {
+   auto res = overwrite(data, location, item);
+   if (res != error::value_not_representable) {
+      return res;
+   }
+
+   const auto begin = data.begin() + static_cast<std::ptrdiff_t>(location.offset);
+   const auto common = std::min(location.size, item.size());
+
+   // Only move the tail once
+   std::ranges::copy(item.first(common), begin);
+   if (item.size() > location.size) {
+      data.insert(begin + static_cast<std::ptrdiff_t>(common), item.begin() + static_cast<std::ptrdiff_t>(common),
+                  item.end());
+   } else {
+      const auto end = begin + static_cast<std::ptrdiff_t>(location.size);
+      data.erase(begin + static_cast<std::ptrdiff_t>(common), end);
+   }
+
+   return error::success;
+}
+
+} // namespace detail
+
+} // namespace cbor
@@ -0,0 +1,681 @@
+/**
+ * @file   file_buffer.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <cbor/config.h>
+#include <cbor/file_buffer.h>
+
+#include <fcntl.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#if CBOR_WITH(IO_URING)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <optional>
+
+namespace {
+
+std::error_code last_error() {
+   return {errno, std::system_category()};
+}
+
+//! Write the whole range with (possibly multiple) pwrite calls
+std::error_code write_fully(int fd, const std::byte *data, std::size_t size, std::uint64_t offset, std::size_t &done) {
+   while (done < size) {
+      const auto res = ::pwrite(fd, data + done, size - done, static_cast<off_t>(offset + done));
+      if (res < 0) {
+         if (errno == EINTR) {
+            continue;
+         }
+         return last_error();
+      }
+      done += static_cast<std::size_t>(res);
+   }
+   return {};
+}
+
+//! Read the whole range with (possibly multiple) pread calls, stopping at the end of the file
+std::error_code read_fully(int fd, std::byte *data, std::size_t size, std::uint64_t offset, std::size_t &done) {
+   while (done < size) {
+      const auto res = ::pread(fd, data + done, size - done, static_cast<off_t>(offset + done));
+      if (res < 0) {
+         if (errno == EINTR) {
+            continue;
+         }
+         return last_error();
+      }
+
+      if (res == 0) {
+         break;
+      }
+      done += static_cast<std::size_t>(res);
+   }
+   return {};
+}
+
+#if CBOR_WITH(IO_URING)
+////////////////////////////////////////////////////////////////////////////////
+/// Class: uring
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Minimal io_uring wrapper: a single submitter, a handful of operations in flight.
+ */
+class uring {
+public:
+   uring() = default;
+   ~uring() { close(); }
+
+   uring(const uring &) = delete;
+   uring &operator=(const uring &) = delete;
+
+public:
+   bool open(unsigned entries) {
+      io_uring_params params{};
+      fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+      if (fd_ < 0) {
+         return false;
+      }
+
+      sq_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+      cq_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+      single_mmap_ = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+      if (single_mmap_) {
+         sq_size_ = cq_size_ = std::max(sq_size_, cq_size_);
+      }
+
+      sq_ptr_ = map(sq_size_, IORING_OFF_SQ_RING);
+      cq_ptr_ = single_mmap_ ? sq_ptr_ : map(cq_size_, IORING_OFF_CQ_RING);
+      sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+      sqes_ = static_cast<io_uring_sqe *>(map(sqes_size_, IORING_OFF_SQES));
+      if (!sq_ptr_ || !cq_ptr_ || !sqes_) {
+         close();
+         return false;
+      }
+
+      auto *sq = static_cast<std::byte *>(sq_ptr_);
+      sq_tail_ = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+      sq_mask_ = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+      sq_array_ = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+
+      auto *cq = static_cast<std::byte *>(cq_ptr_);
+      cq_head_ = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+      cq_tail_ = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+      cq_mask_ = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+      cqes_ = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+
+      return true;
+   }
+
+   void close() {
+      if (sqes_) {
+         ::munmap(sqes_, sqes_size_);
+      }
+
+      if (cq_ptr_ && !single_mmap_) {
+         ::munmap(cq_ptr_, cq_size_);
+      }
+
+      if (sq_ptr_) {
+         ::munmap(sq_ptr_, sq_size_);
+      }
+
+      if (fd_ >= 0) {
+         ::close(fd_);
+      }
+
+      fd_ = -1;
+      sq_ptr_ = cq_ptr_ = nullptr;
+      sq_tail_ = sq_array_ = nullptr;
+      cq_head_ = cq_tail_ = nullptr;
+      sqes_ = nullptr;
+      cqes_ = nullptr;
+   }
+
+   [[nodiscard]] bool is_open() const { return fd_ >= 0; }
+
+   bool submit(const io_uring_sqe &sqe) {
+      const auto tail = std::atomic_ref<unsigned>{*sq_tail_}.load(std::memory_order_relaxed);
+      const auto idx = tail & sq_mask_;
+
+      sqes_[idx] = sqe;
+      sq_array_[idx] = idx;
+      std::atomic_ref<unsigned>{*sq_tail_}.store(tail + 1, std::memory_order_release);
+
+      for (;;) {
+         const auto res = ::syscall(__NR_io_uring_enter, fd_, 1U, 0U, 0U, nullptr, 0);
+         if (res == 1) {
+            return true;
+         }
+
+         if (res < 0 && errno == EINTR) {
+            continue;
+         }
+
+         return false;
+      }
+   }
+
+   bool wait(io_uring_cqe &cqe) {
+      for (;;) {
+         const auto head = std::atomic_ref<unsigned>{*cq_head_}.load(std::memory_order_relaxed);
+         const auto tail = std::atomic_ref<unsigned>{*cq_tail_}.load(std::memory_order_acquire);
+         if (head != tail) {
+            cqe = cqes_[head & cq_mask_];
+            std::atomic_ref<unsigned>{*cq_head_}.store(head + 1, std::memory_order_release);
+            return true;
+         }
+
+         const auto res = ::syscall(__NR_io_uring_enter, fd_, 0U, 1U, IORING_ENTER_GETEVENTS, nullptr, 0);
+         if (res < 0 && errno != EINTR) {
+            return false;
+         }
+      }
+   }
+
+private:
+   void *map(std::size_t size, off_t offset) const {
+      void *res = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, offset);
+      return (res == MAP_FAILED) ? nullptr : res;
+   }
+
+private:
+   int fd_{-1};
+   bool single_mmap_{false};
+
+   void *sq_ptr_{nullptr};
+   std::size_t sq_size_{0};
+   unsigned *sq_tail_{nullptr};
+   unsigned sq_mask_{0};
+   unsigned *sq_array_{nullptr};
+
+   io_uring_sqe *sqes_{nullptr};
+   std::size_t sqes_size_{0};
+
+   void *cq_ptr_{nullptr};
+   std::size_t cq_size_{0};
+   unsigned *cq_head_{nullptr};
+   unsigned *cq_tail_{nullptr};
+   unsigned cq_mask_{0};
+   io_uring_cqe *cqes_{nullptr};
+};
+#endif // CBOR_WITH(IO_URING)
+
+} // namespace
+
+namespace cbor::detail {
+
+#if CBOR_WITH(IO_URING) && CBOR_WITH(TESTING_HOOKS)
+namespace {
+
+//! Result to report instead of the next reaped completion (see override_next_io_uring_result)
+std::optional<std::int32_t> next_result_override{};
+
+} // namespace
+#endif // CBOR_WITH(IO_URING) && CBOR_WITH(TESTING_HOOKS)
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: file_io
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * File I/O backend: up to one positional read or write per slot in flight.
+ */
+class file_io {
+public:
+   inline static constexpr std::size_t num_slots = 2;
+
+   //! Largest transfer the kernel performs in one read or write (MAX_RW_COUNT), also fits the 32-bit SQE length
+   inline static constexpr std::size_t max_transfer_size = 0x7ffff000;
+
+public:
+   explicit file_io(bool use_io_uring) {
+#if CBOR_WITH(IO_URING)
+      if (use_io_uring) {
+         ring_.open(4);
+      }
+#else
+      (void)use_io_uring;
+#endif
+   }
+
+   ~file_io() { close(); }
+
+public:
+   std::error_code open(const std::filesystem::path &path, int flags) {
+      close();
+
+      fd_ = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+      if (fd_ == -1) {
+         return last_error();
+      }
+
+      return {};
+   }
+
+   void close() {
+      for (std::size_t slot = 0; slot < num_slots; ++slot) {
+         std::size_t processed;
+         (void)wait(slot, processed);
+      }
+
+      if (fd_ != -1) {
+         ::close(fd_);
+         fd_ = -1;
+      }
+   }
+
+   [[nodiscard]] int fd() const { return fd_; }
+   [[nodiscard]] bool is_open() const { return fd_ != -1; }
+
+   [[nodiscard]] bool uses_io_uring() const {
+#if CBOR_WITH(IO_URING)
+      return ring_.is_open() && !retiring_;
+#else
+      return false;
+#endif
+   }
+
+   void start(std::size_t slot, bool write, std::byte *data, std::size_t size, std::uint64_t offset) {
+      auto &op = operations_[slot];
+      op = operation{.write = write, .data = data, .size = size, .offset = offset};
+
+#if CBOR_WITH(IO_URING)
+      if (ring_.is_open() && !retiring_) {
+         io_uring_sqe sqe{};
+         sqe.opcode = write ? IORING_OP_WRITE : IORING_OP_READ;
+         sqe.fd = fd_;
+         sqe.addr = reinterpret_cast<std::uint64_t>(data);
+         // Anything past the limit is finished synchronously, just like any other short read or write
+         sqe.len = static_cast<std::uint32_t>(std::min(size, max_transfer_size));
+         sqe.off = offset;
+         sqe.user_data = slot;
+
+         if (ring_.submit(sqe)) {
+            op.pending = true;
+            return;
+         }
+
+         // Don't bother with the ring anymore
+         retire_ring();
+      }
+#endif
+
+      finish_synchronously(op);
+   }
+
+   std::error_code wait(std::size_t slot, std::size_t &processed) {
+      auto &op = operations_[slot];
+
+#if CBOR_WITH(IO_URING)
+      while (op.pending) {
+         io_uring_cqe cqe{};
+         if (!ring_.wait(cqe)) {
+            // Can't tell what happened to the in-flight operations anymore
+            for (auto &o : operations_) {
+               if (o.pending) {
+                  o.pending = false;
+                  o.result = last_error();
+               }
+            }
+            ring_.close();
+            retiring_ = false;
+            break;
+         }
+
+#if CBOR_WITH(TESTING_HOOKS)
+         if (next_result_override) {
+            cqe.res = *next_result_override;
+            next_result_override.reset();
+         }
+#endif
+
+         complete(operations_[cqe.user_data], cqe.res);
+      }
+#endif
+
+      processed = op.done;
+      return op.result;
+   }
+
+private:
+   struct operation {
+      bool write{false};
+      std::byte *data{nullptr};
+      std::size_t size{0};
+      std::uint64_t offset{0};
+
+      bool pending{false};
+      std::size_t done{0};
+      std::error_code result{};
+   };
+
+   void finish_synchronously(operation &op) {
+      op.pending = false;
+      if (op.write) {
+         op.result = write_fully(fd_, op.data, op.size, op.offset, op.done);
+      } else {
+         op.result = read_fully(fd_, op.data, op.size, op.offset, op.done);
+      }
+   }
+
+#if CBOR_WITH(IO_URING)
+   void complete(operation &op, std::int32_t res) {
+      op.pending = false;
+
+      if (res == -EINVAL || res == -EOPNOTSUPP) {
+         // Operation not supported by the kernel: use the fallback from now on
+         finish_synchronously(op);
+         retire_ring();
+         return;
+      }
+
+      if (res < 0) {
+         op.result = std::error_code{-res, std::system_category()};
+      } else {
+         op.done += static_cast<std::size_t>(res);
+         if (op.done < op.size && res != 0) {
+            // Short read or write, handle the rest synchronously
+            finish_synchronously(op);
+         }
+      }
+
+      close_retired_ring();
+   }
+
+   //! Stop submitting to the ring, and close it as soon as the in-flight operations are reaped
+   void retire_ring() {
+      retiring_ = true;
+      close_retired_ring();
+   }
+
+   void close_retired_ring() {
+      if (!retiring_) {
+         return;
+      }
+
+      for (const auto &o : operations_) {
+         if (o.pending) {
+            return;
+         }
+      }
+
+      ring_.close();
+      retiring_ = false;
+   }
+
+   uring ring_{};
+
+   //! The ring is not used for new operations, but some are still in flight
+   bool retiring_{false};
+#endif
+
+   int fd_{-1};
+   std::array<operation, num_slots> operations_{};
+};
+
+#if CBOR_WITH(TESTING_HOOKS)
+CBOR_EXPORT void override_next_io_uring_result(std::int32_t res) {
+#if CBOR_WITH(IO_URING)
+   next_result_override = res;
+#else
+   (void)res;
+#endif
+}
+#endif // CBOR_WITH(TESTING_HOOKS)
+
+} // namespace cbor::detail
+
+using namespace cbor;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: file_writer
+////////////////////////////////////////////////////////////////////////////////
+file_writer::file_writer(std::size_t staging_size, bool use_io_uring)
+   : io_{std::make_unique<detail::file_io>(use_io_uring)} {
+   for (auto &s : staging_) {
+      s.resize(std::max<std::size_t>(staging_size, 1));
+   }
+}
+
+file_writer::~file_writer() {
+   (void)close();
+}
+
+std::error_code file_writer::open(const std::filesystem::path &path) {
+   (void)close();
+
+   base_ = 0;
+   staged_ = 0;
+   high_water_ = 0;
+   error_ = {};
+
+   return io_->open(path, O_WRONLY | O_CREAT | O_TRUNC);
+}
+
+std::error_code file_writer::flush() {
+   auto res = submit();
+   if (res) {
+      return res;
+   }
+
+   for (std::size_t slot = 0; slot < detail::file_io::num_slots; ++slot) {
+      std::size_t processed;
+      res = io_->wait(slot, processed);
+      if (res && !error_) {
+         error_ = res;
+      }
+   }
+
+   return error_;
+}
+
+std::error_code file_writer::close() {
+   if (!io_->is_open()) {
+      return error::success;
+   }
+
+   auto res = flush();
+
+   // Get rid of everything written past a rollback
+   if (!res && high_water_ > size() && ::ftruncate(io_->fd(), static_cast<off_t>(size())) == -1) {
+      res = last_error();
+   }
+
+   io_->close();
+   return res;
+}
+
+bool file_writer::uses_io_uring() const {
+   return io_->uses_io_uring();
+}
+
+std::error_code file_writer::write(const_span_t v) {
+   if (!io_->is_open()) {
+      return error::invalid_usage;
+   }
+
+   if (error_) {
+      return error_;
+   }
+
+   while (!v.empty()) {
+      auto &current = staging_[current_];
+      const auto chunk = std::min(v.size(), current.size() - staged_);
+
+      std::memcpy(current.data() + staged_, v.data(), chunk);
+      staged_ += chunk;
+      v = v.subspan(chunk);
+
+      if (staged_ == current.size()) {
+         auto res = submit();
+         if (res) {
+            return res;
+         }
+      }
+   }
+
+   return error::success;
+}
+
+std::error_code file_writer::submit() {
+   if (error_) {
+      return error_;
+   }
+
+   if (staged_ == 0) {
+      return error::success;
+   }
+
+   // Hand the current staging area over, and continue in the other one
+   io_->start(current_, true, staging_[current_].data(), staged_, base_);
+
+   base_ += staged_;
+   high_water_ = std::max(high_water_, base_);
+   staged_ = 0;
+   current_ = (current_ + 1) % staging_.size();
+
+   // The other staging area might still be in use
+   std::size_t processed;
+   auto res = io_->wait(current_, processed);
+   if (res) {
+      error_ = res;
+   }
+
+   return res;
+}
+
+file_writer::rollback_token_t file_writer::begin_nested_write() {
+   // Just keep track of the total size before writing
+   return static_cast<rollback_token_t>(size());
+}
+
+void file_writer::rollback_nested_write(rollback_token_t token) {
+   const auto target = static_cast<std::uint64_t>(token);
+   if (target >= base_) {
+      // Still in the current staging area
+      staged_ = static_cast<std::size_t>(target - base_);
+      return;
+   }
+
+   // Already handed over: wait for the writes to finish, and overwrite them later on
+   for (std::size_t slot = 0; slot < detail::file_io::num_slots; ++slot) {
+      std::size_t processed;
+      auto res = io_->wait(slot, processed);
+      if (res && !error_) {
+         error_ = res;
+      }
+   }
+
+   base_ = target;
+   staged_ = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: file_reader
+////////////////////////////////////////////////////////////////////////////////
+file_reader::file_reader(std::size_t window_size, bool use_io_uring)
+   : io_{std::make_unique<detail::file_io>(use_io_uring)}
+   , window_size_{std::max<std::size_t>(window_size, 1)} {
+   for (auto &s : staging_) {
+      s.resize(window_size_ * 2);
+   }
+}
+
+file_reader::~file_reader() {
+   close();
+}
+
+std::error_code file_reader::open(const std::filesystem::path &path) {
+   close();
+
+   auto res = io_->open(path, O_RDONLY);
+   if (res) {
+      return res;
+   }
+
+   // Read the first window synchronously
+   current_ = 0;
+   io_->start(current_, false, staging_[current_].data() + window_size_, window_size_, 0);
+
+   std::size_t processed;
+   res = io_->wait(current_, processed);
+   if (res) {
+      io_->close();
+      return res;
+   }
+
+   begin_ = window_size_;
+   end_ = window_size_ + processed;
+   offset_ = processed;
+
+   return prefetch((current_ + 1) % staging_.size());
+}
+
+void file_reader::close() {
+   io_->close();
+
+   begin_ = end_ = 0;
+   offset_ = 0;
+   prefetching_ = false;
+}
+
+void file_reader::consume(std::size_t size) {
+   begin_ += std::min(size, end_ - begin_);
+}
+
+std::error_code file_reader::next() {
+   if (!io_->is_open()) {
+      return error::invalid_usage;
+   }
+
+   const auto tail = end_ - begin_;
+   if (tail > window_size_) {
+      return error::buffer_overflow;
+   }
+
+   const auto other = (current_ + 1) % staging_.size();
+
+   std::size_t processed = 0;
+   if (prefetching_) {
+      prefetching_ = false;
+      auto res = io_->wait(other, processed);
+      if (res) {
+         return res;
+      }
+   }
+
+   if (processed == 0) {
+      // Nothing left to read, keep the current window
+      return error::buffer_underflow;
+   }
+
+   // Carry the unconsumed bytes over, right in front of the prefetched window
+   auto &target = staging_[other];
+   std::memcpy(target.data() + window_size_ - tail, staging_[current_].data() + begin_, tail);
+
+   current_ = other;
+   begin_ = window_size_ - tail;
+   end_ = window_size_ + processed;
+   offset_ += processed;
+
+   return prefetch((current_ + 1) % staging_.size());
+}
+
+bool file_reader::uses_io_uring() const {
+   return io_->uses_io_uring();
+}
+
+std::error_code file_reader::prefetch(std::size_t target) {
+   io_->start(target, false, staging_[target].data() + window_size_, window_size_, offset_);
+   prefetching_ = true;
+   return error::success;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file   mapped_file.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <cbor/mapped_file.h>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <utility>
+
+using namespace cbor;
+
+namespace {
+
+//! Empty files cannot be mapped, but should still result in a valid (empty) buffer
+const std::byte empty_file_data[1]{};
+
+#if defined(_WIN32)
+std::error_code last_error() {
+   return {static_cast<int>(::GetLastError()), std::system_category()};
+}
+
+std::error_code map_file(const std::filesystem::path &path, const std::byte *&data, std::size_t &size) {
+   HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                               FILE_ATTRIBUTE_NORMAL, nullptr);
+   if (file == INVALID_HANDLE_VALUE) {
+      return last_error();
+   }
+
+   LARGE_INTEGER file_size{};
+   if (!::GetFileSizeEx(file, &file_size)) {
+      const auto res = last_error();
+      ::CloseHandle(file);
+      return res;
+   }
+
+   if (file_size.QuadPart == 0) {
+      ::CloseHandle(file);
+      data = empty_file_data;
+      size = 0;
+      return {};
+   }
+
+   HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+   if (!mapping) {
+      const auto res = last_error();
+      ::CloseHandle(file);
+      return res;
+   }
+
+   // The view keeps both the mapping and the file alive
+   void *view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+   const auto res = view ? std::error_code{} : last_error();
+
+   ::CloseHandle(mapping);
+   ::CloseHandle(file);
+
+   if (res) {
+      return res;
+   }
+
+   data = static_cast<const std::byte *>(view);
+   size = static_cast<std::size_t>(file_size.QuadPart);
+   return {};
+}
+
+void unmap_file(const std::byte *data, std::size_t) {
+   ::UnmapViewOfFile(data);
+}
+#else
+std::error_code last_error() {
+   return {errno, std::system_category()};
+}
+
+std::error_code map_file(const std::filesystem::path &path, const std::byte *&data, std::size_t &size) {
+   const int fd = ::open(path.c_str(), O_RDONLY);
+   if (fd == -1) {
+      return last_error();
+   }
+
+   struct stat info {};
+   if (::fstat(fd, &info) == -1) {
+      const auto res = last_error();
+      ::close(fd);
+      return res;
+   }
+
+   if (info.st_size == 0) {
+      ::close(fd);
+      data = empty_file_data;
+      size = 0;
+      return {};
+   }
+
+   // The mapping keeps the file alive
+   void *view = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+   const auto res = (view != MAP_FAILED) ? std::error_code{} : last_error();
+
+   ::close(fd);
+
+   if (res) {
+      return res;
+   }
+
+   data = static_cast<const std::byte *>(view);
+   size = static_cast<std::size_t>(info.st_size);
+   return {};
+}
+
+void unmap_file(const std::byte *data, std::size_t size) {
+   ::munmap(const_cast<std::byte *>(data), size);
+}
+#endif
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: mapped_file
+////////////////////////////////////////////////////////////////////////////////
+mapped_file::~mapped_file() {
+   close();
+}
+
+mapped_file::mapped_file(mapped_file &&o) noexcept
+   : data_{std::exchange(o.data_, nullptr)}
+   , size_{std::exchange(o.size_, 0)} {
+   // Nothing to do here
+}
+
+mapped_file &mapped_file::operator=(mapped_file &&o) noexcept {
+   if (this != &o) {
+      close();
+      data_ = std::exchange(o.data_, nullptr);
+      size_ = std::exchange(o.size_, 0);
+   }
+   return *this;
+}
+
+std::error_code mapped_file::open(const std::filesystem::path &path) {
+   close();
+
+   const std::byte *data{nullptr};
+   std::size_t size{0};
+   auto res = map_file(path, data, size);
+   if (res) {
+      return res;
+   }
+
+   data_ = data;
+   size_ = size;
+   return error::success;
+}
+
+void mapped_file::close() {
+   if (data_ && data_ != empty_file_data) {
+      unmap_file(data_, size_);
+   }
+
+   data_ = nullptr;
+   size_ = 0;
+}
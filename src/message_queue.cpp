@@ -0,0 +1,192 @@
+/**
+ * @file   message_queue.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <cbor/message_queue.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <utility>
+
+using namespace cbor;
+
+struct alignas(64) message_queue::slot {
+   //! Slot state, see the "Bounded MPMC queue" by Dmitry Vyukov:
+   //! - position: free, can be reserved by a producer
+   //! - position + 1: published, can be claimed by a consumer
+   std::atomic<std::uint64_t> sequence;
+
+   //! Position the slot was claimed at by a consumer
+   std::uint64_t position;
+
+   std::byte *data;
+   std::size_t size;
+   bool discarded;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: message_queue::writer
+////////////////////////////////////////////////////////////////////////////////
+message_queue::writer::~writer() {
+   if (slot_) {
+      finish(true);
+   }
+}
+
+message_queue::writer::writer(writer &&o) noexcept
+   : slot_{std::exchange(o.slot_, nullptr)}
+   , data_{std::exchange(o.data_, nullptr)}
+   , capacity_{std::exchange(o.capacity_, 0)}
+   , position_{std::exchange(o.position_, 0)}
+   , size_{std::exchange(o.size_, 0)} {
+   // Nothing to do here
+}
+
+message_queue::writer &message_queue::writer::operator=(writer &&o) noexcept {
+   if (this != &o) {
+      if (slot_) {
+         finish(true);
+      }
+
+      slot_ = std::exchange(o.slot_, nullptr);
+      data_ = std::exchange(o.data_, nullptr);
+      capacity_ = std::exchange(o.capacity_, 0);
+      position_ = std::exchange(o.position_, 0);
+      size_ = std::exchange(o.size_, 0);
+   }
+   return *this;
+}
+
+std::error_code message_queue::writer::write(const_span_t v) {
+   if (!slot_) {
+      return error::invalid_usage;
+   }
+
+   if (capacity_ - size_ < v.size()) {
+      return error::buffer_overflow;
+   }
+
+   if (!v.empty()) {
+      std::memcpy(data_ + size_, v.data(), v.size());
+      size_ += v.size();
+   }
+
+   return error::success;
+}
+
+void message_queue::writer::publish() {
+   if (slot_) {
+      finish(false);
+   }
+}
+
+void message_queue::writer::discard() {
+   if (slot_) {
+      finish(true);
+   }
+}
+
+message_queue::writer::rollback_token_t message_queue::writer::begin_nested_write() {
+   // Just keep track of the message size before writing
+   return static_cast<rollback_token_t>(size_);
+}
+
+void message_queue::writer::rollback_nested_write(rollback_token_t token) {
+   // Rollback by changing to the original message size
+   size_ = static_cast<std::size_t>(token);
+}
+
+void message_queue::writer::finish(bool discarded) {
+   slot_->size = size_;
+   slot_->discarded = discarded;
+   slot_->sequence.store(position_ + 1, std::memory_order_release);
+
+   slot_ = nullptr;
+   data_ = nullptr;
+   capacity_ = 0;
+   position_ = 0;
+   size_ = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: message_queue
+////////////////////////////////////////////////////////////////////////////////
+message_queue::message_queue(std::size_t slot_count, std::size_t slot_size)
+   : mask_{std::bit_ceil(std::max<std::size_t>(slot_count, 1)) - 1}
+   , slot_size_{slot_size}
+   , slots_{new slot[mask_ + 1]}
+   , storage_{new std::byte[(mask_ + 1) * slot_size]} {
+   for (std::size_t i = 0; i <= mask_; ++i) {
+      auto &s = slots_[i];
+      s.sequence.store(i, std::memory_order_relaxed);
+      s.position = 0;
+      s.data = storage_.get() + i * slot_size_;
+      s.size = 0;
+      s.discarded = false;
+   }
+}
+
+message_queue::~message_queue() = default;
+
+std::error_code message_queue::reserve(writer &w) {
+   w.discard();
+
+   auto position = enqueue_position_.load(std::memory_order_relaxed);
+   for (;;) {
+      auto &s = slots_[position & mask_];
+      const auto sequence = s.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::int64_t>(sequence - position);
+
+      if (diff == 0) {
+         // The slot is free, try claiming it
+         if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+            w.slot_ = &s;
+            w.data_ = s.data;
+            w.capacity_ = slot_size_;
+            w.position_ = position;
+            w.size_ = 0;
+            return error::success;
+         }
+      } else if (diff < 0) {
+         // The slot still holds a message from the previous round: the queue is full
+         return error::buffer_overflow;
+      } else {
+         // Another producer got ahead of us
+         position = enqueue_position_.load(std::memory_order_relaxed);
+      }
+   }
+}
+
+bool message_queue::claim(slot *&s, buffer::const_span_t &message, bool &discarded) {
+   auto position = dequeue_position_.load(std::memory_order_relaxed);
+   for (;;) {
+      auto &candidate = slots_[position & mask_];
+      const auto sequence = candidate.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::int64_t>(sequence - (position + 1));
+
+      if (diff == 0) {
+         // The slot is published, try claiming it
+         if (dequeue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+            candidate.position = position;
+            s = &candidate;
+            message = buffer::const_span_t{candidate.data, candidate.size};
+            discarded = candidate.discarded;
+            return true;
+         }
+      } else if (diff < 0) {
+         // Nothing published yet
+         return false;
+      } else {
+         // Another consumer got ahead of us
+         position = dequeue_position_.load(std::memory_order_relaxed);
+      }
+   }
+}
+
+void message_queue::release(slot *s) {
+   // Make the slot available for the next round
+   s->sequence.store(s->position + mask_ + 1, std::memory_order_release);
+}
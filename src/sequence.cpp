@@ -0,0 +1,207 @@
+/**
+ * @file   sequence.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <cbor/decoding.h>
+#include <cbor/encoding.h>
+#include <cbor/sequence.h>
+
+#include <algorithm>
+
+namespace cbor {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: sequence_index
+////////////////////////////////////////////////////////////////////////////////
+sequence_index::sequence_index(std::uint64_t stride)
+   : stride_{std::max<std::uint64_t>(stride, 1)} {
+   // Nothing to do here
+}
+
+std::error_code sequence_index::build(buffer::const_span_t sequence) {
+   offsets_.clear();
+   item_count_ = 0;
+   sequence_size_ = 0;
+
+   read_buffer buf{sequence};
+   while (static_cast<std::size_t>(buf.read_position()) < sequence.size()) {
+      if (item_count_ % stride_ == 0) {
+         offsets_.push_back(static_cast<std::uint64_t>(buf.read_position()));
+      }
+
+      auto res = skip(buf);
+      if (res) {
+         offsets_.clear();
+         item_count_ = 0;
+         return res;
+      }
+
+      ++item_count_;
+   }
+
+   sequence_size_ = sequence.size();
+   return error::success;
+}
+
+std::error_code sequence_index::seek(read_buffer &buf, std::uint64_t item) const {
+   if (buf.size() != sequence_size_) {
+      // Not the indexed sequence
+      return error::invalid_usage;
+   }
+
+   if (item > item_count_) {
+      return error::buffer_underflow;
+   }
+
+   if (item == item_count_) {
+      buf.reset(static_cast<std::ptrdiff_t>(sequence_size_));
+      return error::success;
+   }
+
+   auto rollback_helper = buf.get_rollback_helper();
+
+   const auto entry = item / stride_;
+   buf.reset(static_cast<std::ptrdiff_t>(offsets_[entry]));
+
+   for (auto remaining = item - entry * stride_; remaining != 0; --remaining) {
+      auto res = skip(buf);
+      if (res) {
+         return res;
+      }
+   }
+
+   rollback_helper.commit();
+
+   return error::success;
+}
+
+std::vector<buffer::const_span_t> sequence_index::partition(buffer::const_span_t sequence, std::size_t count) const {
+   std::vector<buffer::const_span_t> result{};
+   if (sequence.size() != sequence_size_ || offsets_.empty() || count == 0) {
+      return result;
+   }
+
+   // Parts can only start at indexed items
+   const auto num_parts = std::min<std::uint64_t>(count, offsets_.size());
+   result.reserve(num_parts);
+
+   std::uint64_t begin = 0;
+   for (std::uint64_t i = 1; i <= num_parts; ++i) {
+      const auto entry = (offsets_.size() * i) / num_parts;
+      const auto end = (entry == offsets_.size()) ? sequence_size_ : offsets_[entry];
+      result.push_back(sequence.subspan(begin, end - begin));
+      begin = end;
+   }
+
+   return result;
+}
+
+std::error_code encode(buffer &buf, const sequence_index &v) {
+   auto rollback_helper = buf.get_rollback_helper();
+
+   auto res = encode_argument(buf, major_type::array, 4U);
+   if (res) {
+      return res;
+   }
+
+   res = encode(buf, v.stride_);
+   if (res) {
+      return res;
+   }
+
+   res = encode(buf, v.item_count_);
+   if (res) {
+      return res;
+   }
+
+   res = encode(buf, v.sequence_size_);
+   if (res) {
+      return res;
+   }
+
+   // Offsets are stored as deltas: those are much smaller than the absolute values, resulting in shorter encodings
+   res = encode_argument(buf, major_type::array, v.offsets_.size());
+   if (res) {
+      return res;
+   }
+
+   std::uint64_t previous = 0;
+   for (const auto offset : v.offsets_) {
+      res = encode(buf, offset - previous);
+      if (res) {
+         return res;
+      }
+      previous = offset;
+   }
+
+   rollback_helper.commit();
+
+   return res;
+}
+
+std::error_code decode(read_buffer &buf, sequence_index &v) {
+   detail::head head{};
+   auto res = head.read(buf);
+   if (res) {
+      return res;
+   }
+
+   if (head.type != major_type::array) {
+      return error::unexpected_type;
+   }
+
+   if (head.decode_argument() != 4) {
+      return error::decoding_error;
+   }
+
+   sequence_index result{};
+
+   res = decode(buf, result.stride_);
+   if (res) {
+      return res;
+   }
+
+   if (result.stride_ == 0) {
+      return error::decoding_error;
+   }
+
+   res = decode(buf, result.item_count_);
+   if (res) {
+      return res;
+   }
+
+   res = decode(buf, result.sequence_size_);
+   if (res) {
+      return res;
+   }
+
+   res = decode(buf, result.offsets_);
+   if (res) {
+      return res;
+   }
+
+   // Restore the absolute offsets, making sure they stay within the sequence
+   std::uint64_t previous = 0;
+   for (auto &offset : result.offsets_) {
+      if (offset > result.sequence_size_ - previous) {
+         return error::decoding_error;
+      }
+
+      offset += previous;
+      previous = offset;
+   }
+
+   // Rounding up by adding stride - 1 could wrap around for hostile item counts
+   const auto expected_entries =
+      result.item_count_ / result.stride_ + static_cast<std::uint64_t>(result.item_count_ % result.stride_ != 0);
+   if (result.offsets_.size() != expected_entries) {
+      return error::decoding_error;
+   }
+
+   v = std::move(result);
+   return error::success;
+}
+
+} // namespace cbor
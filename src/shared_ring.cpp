@@ -0,0 +1,341 @@
+/**
+ * @file   shared_ring.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <cbor/shared_ring.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace cbor::detail {
+
+//! Shared control block, placed in the first page of the ring memory
+struct ring_control {
+   inline static constexpr std::uint64_t magic_value = 0x43424F5252494E47; // "CBORRING"
+
+   std::uint64_t magic;
+   std::uint64_t capacity;
+
+   //! Total number of bytes ever written (only modified by the producer)
+   alignas(64) std::atomic<std::uint64_t> write_position;
+
+   //! Total number of bytes ever released (only modified by the consumer)
+   alignas(64) std::atomic<std::uint64_t> read_position;
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Shared memory requires lock-free atomics");
+
+} // namespace cbor::detail
+
+using namespace cbor;
+
+namespace {
+
+//! Every message is prefixed with its size
+using record_header_t = std::uint64_t;
+
+inline constexpr std::size_t record_alignment = sizeof(record_header_t);
+
+std::size_t page_size() {
+   return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+}
+
+std::uint64_t record_size(std::uint64_t message_size) {
+   const auto size = sizeof(record_header_t) + message_size;
+   return (size + record_alignment - 1) & ~static_cast<std::uint64_t>(record_alignment - 1);
+}
+
+std::error_code last_error() {
+   return {errno, std::system_category()};
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: shared_ring
+////////////////////////////////////////////////////////////////////////////////
+shared_ring::~shared_ring() {
+   close();
+}
+
+shared_ring::shared_ring(shared_ring &&o) noexcept
+   : control_{std::exchange(o.control_, nullptr)}
+   , data_{std::exchange(o.data_, nullptr)}
+   , capacity_{std::exchange(o.capacity_, 0)}
+   , fd_{std::exchange(o.fd_, -1)} {
+   // Nothing to do here
+}
+
+shared_ring &shared_ring::operator=(shared_ring &&o) noexcept {
+   if (this != &o) {
+      close();
+      control_ = std::exchange(o.control_, nullptr);
+      data_ = std::exchange(o.data_, nullptr);
+      capacity_ = std::exchange(o.capacity_, 0);
+      fd_ = std::exchange(o.fd_, -1);
+   }
+   return *this;
+}
+
+std::error_code shared_ring::create(std::size_t capacity) {
+   close();
+
+   const auto page = page_size();
+   capacity = std::bit_ceil(std::max(capacity, page));
+
+   const int fd = ::memfd_create("cbor-ring", MFD_CLOEXEC);
+   if (fd == -1) {
+      return last_error();
+   }
+
+   if (::ftruncate(fd, static_cast<off_t>(page + capacity)) == -1) {
+      const auto res = last_error();
+      ::close(fd);
+      return res;
+   }
+
+   auto res = map(fd, capacity);
+   if (res) {
+      ::close(fd);
+      return res;
+   }
+
+   // The memory is zero-initialized, but we still have to start the atomics' lifetime
+   auto control = new (control_) detail::ring_control{};
+   control->capacity = capacity;
+   control->write_position.store(0, std::memory_order_relaxed);
+   control->read_position.store(0, std::memory_order_relaxed);
+   control->magic = detail::ring_control::magic_value;
+
+   return error::success;
+}
+
+std::error_code shared_ring::attach(int fd) {
+   close();
+
+   const int own_fd = ::fcntl(fd, F_DUPFD_CLOEXEC, 0);
+   if (own_fd == -1) {
+      return last_error();
+   }
+
+   struct stat info {};
+   if (::fstat(own_fd, &info) == -1) {
+      const auto res = last_error();
+      ::close(own_fd);
+      return res;
+   }
+
+   const auto page = page_size();
+   const auto total_size = static_cast<std::size_t>(info.st_size);
+   if (total_size <= page || !std::has_single_bit(total_size - page)) {
+      ::close(own_fd);
+      return error::invalid_usage;
+   }
+
+   auto res = map(own_fd, total_size - page);
+   if (res) {
+      ::close(own_fd);
+      return res;
+   }
+
+   if (control_->magic != detail::ring_control::magic_value || control_->capacity != capacity_) {
+      close();
+      return error::invalid_usage;
+   }
+
+   return error::success;
+}
+
+std::error_code shared_ring::map(int fd, std::size_t capacity) {
+   const auto page = page_size();
+
+   void *control = ::mmap(nullptr, page, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   if (control == MAP_FAILED) {
+      return last_error();
+   }
+
+   // Reserve an address range for two copies of the data area, and map the data area into both halves
+   void *reserved = ::mmap(nullptr, capacity * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+   if (reserved == MAP_FAILED) {
+      const auto res = last_error();
+      ::munmap(control, page);
+      return res;
+   }
+
+   auto *data = static_cast<std::byte *>(reserved);
+   for (auto *half : {data, data + capacity}) {
+      void *mapped = ::mmap(half, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, static_cast<off_t>(page));
+      if (mapped == MAP_FAILED) {
+         const auto res = last_error();
+         ::munmap(reserved, capacity * 2);
+         ::munmap(control, page);
+         return res;
+      }
+   }
+
+   control_ = static_cast<detail::ring_control *>(control);
+   data_ = data;
+   capacity_ = capacity;
+   fd_ = fd;
+
+   return error::success;
+}
+
+void shared_ring::close() {
+   if (data_) {
+      ::munmap(data_, capacity_ * 2);
+   }
+
+   if (control_) {
+      ::munmap(control_, page_size());
+   }
+
+   if (fd_ != -1) {
+      ::close(fd_);
+   }
+
+   control_ = nullptr;
+   data_ = nullptr;
+   capacity_ = 0;
+   fd_ = -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: ring_writer
+////////////////////////////////////////////////////////////////////////////////
+ring_writer::ring_writer(shared_ring &ring)
+   : ring_{&ring}
+   , position_{ring.is_open() ? ring.control_->write_position.load(std::memory_order_relaxed) : 0} {
+   // Nothing to do here
+}
+
+std::error_code ring_writer::write(const_span_t v) {
+   if (!ring_->is_open()) {
+      return error::invalid_usage;
+   }
+
+   if (v.empty()) {
+      return error::success;
+   }
+
+   std::uint64_t available;
+   auto res = free_space(available);
+   if (res) {
+      return res;
+   }
+
+   // Check the size before rounding it up: huge sizes would wrap around
+   if (v.size() > ring_->capacity_ - sizeof(record_header_t) - size_ || record_size(size_ + v.size()) > available) {
+      return error::buffer_overflow;
+   }
+
+   // Thanks to the double mapping, the whole record is contiguous
+   auto *target = ring_->data_ + (position_ & (ring_->capacity_ - 1)) + sizeof(record_header_t) + size_;
+   std::memcpy(target, v.data(), v.size());
+   size_ += v.size();
+
+   return error::success;
+}
+
+std::error_code ring_writer::commit() {
+   if (!ring_->is_open()) {
+      return error::invalid_usage;
+   }
+
+   // Non-empty messages already have their space reserved by the writes, but empty ones still need a header
+   std::uint64_t available;
+   auto res = free_space(available);
+   if (res) {
+      return res;
+   }
+
+   if (record_size(size_) > available) {
+      return error::buffer_overflow;
+   }
+
+   const record_header_t header = size_;
+   std::memcpy(ring_->data_ + (position_ & (ring_->capacity_ - 1)), &header, sizeof(header));
+
+   position_ += record_size(size_);
+   ring_->control_->write_position.store(position_, std::memory_order_release);
+   size_ = 0;
+
+   return error::success;
+}
+
+std::error_code ring_writer::free_space(std::uint64_t &available) const {
+   // The read position comes from the consumer, and can't be trusted not to overtake the producer
+   const auto read_position = ring_->control_->read_position.load(std::memory_order_acquire);
+   if (read_position > position_ || position_ - read_position > ring_->capacity_) {
+      return error::ill_formed;
+   }
+
+   available = ring_->capacity_ - (position_ - read_position);
+   return error::success;
+}
+
+ring_writer::rollback_token_t ring_writer::begin_nested_write() {
+   // Just keep track of the message size before writing
+   return static_cast<rollback_token_t>(size_);
+}
+
+void ring_writer::rollback_nested_write(rollback_token_t token) {
+   // Rollback by changing to the original message size
+   size_ = static_cast<std::size_t>(token);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: ring_reader
+////////////////////////////////////////////////////////////////////////////////
+ring_reader::ring_reader(shared_ring &ring)
+   : ring_{&ring}
+   , position_{ring.is_open() ? ring.control_->read_position.load(std::memory_order_relaxed) : 0} {
+   // Nothing to do here
+}
+
+std::error_code ring_reader::peek(buffer::const_span_t &message) {
+   if (!ring_->is_open()) {
+      return error::invalid_usage;
+   }
+
+   const auto write_position = ring_->control_->write_position.load(std::memory_order_acquire);
+   if (write_position == position_) {
+      return error::buffer_underflow;
+   }
+
+   const auto *record = ring_->data_ + (position_ & (ring_->capacity_ - 1));
+
+   record_header_t header;
+   std::memcpy(&header, record, sizeof(header));
+
+   // Check the size before rounding it up: huge sizes would wrap around
+   if (header > ring_->capacity_ - sizeof(record_header_t) || record_size(header) > write_position - position_) {
+      // Corrupted ring
+      return error::ill_formed;
+   }
+
+   message = buffer::const_span_t{record + sizeof(record_header_t), static_cast<std::size_t>(header)};
+   pending_ = record_size(header);
+
+   return error::success;
+}
+
+void ring_reader::release() {
+   if (!ring_->is_open()) {
+      return;
+   }
+
+   position_ += std::exchange(pending_, 0);
+   ring_->control_->read_position.store(position_, std::memory_order_release);
+}
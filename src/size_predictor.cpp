@@ -0,0 +1,68 @@
+/**
+ * @file   size_predictor.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <cbor/config.h>
+#include <cbor/size_predictor.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cbor {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Struct: size_predictor::statistics
+////////////////////////////////////////////////////////////////////////////////
+std::size_t size_predictor::statistics::predicted() const {
+   return static_cast<std::size_t>(std::ceil(mean + 2 * deviation));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Class: size_predictor
+////////////////////////////////////////////////////////////////////////////////
+size_predictor::size_predictor(double weight)
+   : weight_{std::clamp(weight, 0.0, 1.0)} {
+   if (weight_ == 0.0) {
+      weight_ = default_weight;
+   }
+}
+
+void size_predictor::record(key_t key, std::size_t size) {
+   auto &s = stats_[key];
+   const auto sample = static_cast<double>(size);
+
+   if (s.samples == 0) {
+      s.mean = sample;
+      s.deviation = 0;
+   } else {
+      // The deviation is updated with the old mean, similar to the TCP round-trip time estimation
+      s.deviation += weight_ * (std::abs(sample - s.mean) - s.deviation);
+      s.mean += weight_ * (sample - s.mean);
+   }
+
+   s.last = size;
+   s.peak = std::max(s.peak, size);
+   ++s.samples;
+}
+
+std::size_t size_predictor::predict(key_t key) const {
+   const auto it = stats_.find(key);
+   if (it == stats_.end()) {
+      return dynamic_buffer_initial_size;
+   }
+
+   return it->second.predicted();
+}
+
+std::optional<size_predictor::statistics> size_predictor::stats(key_t key) const {
+   const auto it = stats_.find(key);
+   if (it == stats_.end()) {
+      return std::nullopt;
+   }
+
+   return it->second;
+}
+
+} // namespace cbor
@@ -125,6 +125,16 @@ void check_encoding(const T &value, std::initializer_list<std::uint8_t> expected
    compare_arrays(value, target, expected);
 }
 
+template <typename T>
+std::vector<std::byte> encode_to_vector(const T &value) {
+   using namespace cbor;
+
+   std::vector<std::byte> result{};
+   cbor::dynamic_buffer buf{result};
+   REQUIRE(!encode(buf, value));
+   return result;
+}
+
 template <typename T>
 inline constexpr std::vector<std::byte> as_bytes(const T &v) {
    std::vector<std::byte> result{};
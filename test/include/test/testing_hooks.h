@@ -0,0 +1,26 @@
+/**
+ * @file   testing_hooks.h
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cbor/config.h>
+#include <cbor/export.h>
+
+#include <cstdint>
+
+#if CBOR_WITH(TESTING_HOOKS)
+
+namespace cbor::detail {
+
+/**
+ * Report `res` (e.g. `-EINVAL`) instead of the actual result of the next reaped io_uring completion.
+ * Not thread-safe, has no effect without io_uring.
+ */
+CBOR_EXPORT void override_next_io_uring_result(std::int32_t res);
+
+} // namespace cbor::detail
+
+#endif // CBOR_WITH(TESTING_HOOKS)
@@ -0,0 +1,151 @@
+/**
+ * @file   codec_benchmark.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ *
+ * Encode/decode benchmarks. Hidden by default, run with:
+ *   cbor_tests "[!benchmark]"
+ * Compare a build with CBOR_WITH_HEADER_ONLY_CODEC=ON against the default one to see the effect of inlining the core
+ * codec functions. Large strings are decoded both by the library and by the previous resize-then-read approach, to see
+ * the cost of zero-filling the target first.
+ */
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cbor/config.h>
+#include <cbor/decoding.h>
+#include <cbor/encoding.h>
+
+#include <test/encoding.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct message {
+   std::uint32_t id;
+   std::int16_t offset;
+   bool valid;
+   float ratio;
+   double value;
+   std::string name;
+};
+
+std::error_code encode_message(cbor::buffer &buf, const message &v) {
+   auto res = cbor::encode(buf, v.id);
+   if (!res) {
+      res = cbor::encode(buf, v.offset);
+   }
+   if (!res) {
+      res = cbor::encode(buf, v.valid);
+   }
+   if (!res) {
+      res = cbor::encode(buf, v.ratio);
+   }
+   if (!res) {
+      res = cbor::encode(buf, v.value);
+   }
+   if (!res) {
+      res = cbor::encode(buf, v.name);
+   }
+   return res;
+}
+
+std::error_code decode_message(cbor::read_buffer &buf, message &v) {
+   auto res = cbor::decode(buf, v.id);
+   if (!res) {
+      res = cbor::decode(buf, v.offset);
+   }
+   if (!res) {
+      res = cbor::decode(buf, v.valid);
+   }
+   if (!res) {
+      res = cbor::decode(buf, v.ratio);
+   }
+   if (!res) {
+      res = cbor::decode(buf, v.value);
+   }
+   if (!res) {
+      res = cbor::decode(buf, v.name);
+   }
+   return res;
+}
+
+const message sample{.id = 1234, .offset = -42, .valid = true, .ratio = 0.5F, .value = 3.14, .name = "sensor"};
+
+//! The way strings and byte vectors used to be decoded: value-initialize the storage, then overwrite it
+template <typename T>
+std::error_code decode_zero_filled(cbor::read_buffer &buf, T &v) {
+   cbor::detail::head head{};
+   auto res = head.read(buf);
+   if (res) {
+      return res;
+   }
+
+   v.resize(head.decode_argument());
+   return buf.read(cbor::buffer::span_t{reinterpret_cast<std::byte *>(v.data()), v.size()});
+}
+
+} // namespace
+
+TEST_CASE("Codec benchmark - small message", "[!benchmark]") {
+#if CBOR_WITH(HEADER_ONLY_CODEC)
+   const std::string mode = "header-only";
+#else
+   const std::string mode = "compiled";
+#endif
+
+   std::vector<std::byte> encoded{};
+   cbor::dynamic_buffer dyn{encoded};
+   REQUIRE(!encode_message(dyn, sample));
+
+   BENCHMARK("Encode (" + mode + ")") {
+      std::array<std::byte, 64> storage{};
+      cbor::static_buffer buf{storage};
+      return encode_message(buf, sample);
+   };
+
+   BENCHMARK("Decode (" + mode + ")") {
+      cbor::read_buffer buf{encoded};
+      message v{};
+      return decode_message(buf, v);
+   };
+}
+
+TEST_CASE("Codec benchmark - large strings", "[!benchmark]") {
+   constexpr std::size_t size = 8 * 1024 * 1024;
+
+   const auto bytes = test::encode_to_vector(std::vector<std::byte>(size, std::byte{0xAB}));
+   const auto text = test::encode_to_vector(std::string(size, 'x'));
+
+   BENCHMARK("Byte string (zero-filled)") {
+      cbor::read_buffer buf{bytes};
+      std::vector<std::byte> v{};
+      (void)decode_zero_filled(buf, v);
+      return v.size();
+   };
+
+   BENCHMARK("Byte string") {
+      cbor::read_buffer buf{bytes};
+      std::vector<std::byte> v{};
+      (void)cbor::decode(buf, v);
+      return v.size();
+   };
+
+   BENCHMARK("Text string (zero-filled)") {
+      cbor::read_buffer buf{text};
+      std::string v{};
+      (void)decode_zero_filled(buf, v);
+      return v.size();
+   };
+
+   BENCHMARK("Text string") {
+      cbor::read_buffer buf{text};
+      std::string v{};
+      (void)cbor::decode(buf, v);
+      return v.size();
+   };
+}
@@ -0,0 +1,189 @@
+/**
+ * @file   cpu_dispatch.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cbor/cpu_dispatch.h>
+#include <cbor/decoding.h>
+
+#include <test/encoding.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace test;
+
+namespace {
+
+std::vector<cbor::cpu::level> supported_levels() {
+   std::vector<cbor::cpu::level> result{};
+   for (const auto l : {cbor::cpu::level::baseline, cbor::cpu::level::sse4_2, cbor::cpu::level::avx2,
+                        cbor::cpu::level::avx512}) {
+      if (l <= cbor::cpu::detected_level()) {
+         result.push_back(l);
+      }
+   }
+   return result;
+}
+
+template <typename T, typename Kernel>
+void check_max_kernel(Kernel kernel) {
+   std::mt19937_64 rng{42};
+   std::uniform_int_distribution<std::uint64_t> dist{0, std::numeric_limits<T>::max()};
+
+   // Cover the vector bodies, as well as the scalar tails of every vector width
+   for (std::size_t size : {0, 1, 7, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 257}) {
+      std::vector<T> v(size);
+      std::generate(v.begin(), v.end(), [&] { return static_cast<T>(dist(rng)); });
+
+      const auto expected = v.empty() ? T{0} : *std::max_element(v.begin(), v.end());
+      INFO("Size: " << size);
+      REQUIRE(kernel(v.data(), v.size()) == expected);
+
+      // The largest value at every position
+      for (std::size_t i = 0; i < size; ++i) {
+         auto copy = std::vector<T>(size, T{1});
+         copy[i] = std::numeric_limits<T>::max();
+         INFO("Position: " << i);
+         REQUIRE(kernel(copy.data(), copy.size()) == std::numeric_limits<T>::max());
+      }
+   }
+}
+
+template <typename Kernel>
+void check_small_int_run_kernel(Kernel kernel) {
+   // Cover the vector bodies, as well as the scalar tails of every vector width
+   for (std::size_t size : {0, 1, 7, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 257}) {
+      // Unsigned and negative integers encoded in the initial byte
+      std::vector<std::uint8_t> v(size);
+      for (std::size_t i = 0; i < size; ++i) {
+         v[i] = static_cast<std::uint8_t>((i % 2 == 0) ? i % 24 : 0x20 + i % 24);
+      }
+
+      INFO("Size: " << size);
+      REQUIRE(kernel(v.data(), v.size()) == size);
+
+      // Every other data item (or an integer with extra bytes) ends the run
+      for (std::size_t i = 0; i < size; ++i) {
+         for (const std::uint8_t stop : {0x18, 0x38, 0x40, 0x60, 0x80, 0xA0, 0xC0, 0xF5, 0xFF}) {
+            auto copy = v;
+            copy[i] = stop;
+            INFO("Position: " << i << ", byte: " << static_cast<int>(stop));
+            REQUIRE(kernel(copy.data(), copy.size()) == i);
+         }
+      }
+   }
+}
+
+} // namespace
+
+TEST_CASE("CPU dispatch - level names", "[cpu_dispatch]") {
+   for (const auto l : {cbor::cpu::level::baseline, cbor::cpu::level::sse4_2, cbor::cpu::level::avx2,
+                        cbor::cpu::level::avx512}) {
+      REQUIRE(cbor::cpu::parse_level(cbor::cpu::to_string(l)) == l);
+   }
+
+   REQUIRE(cbor::cpu::to_string(cbor::cpu::level::sse4_2) == "sse4.2");
+   REQUIRE(!cbor::cpu::parse_level("avx1024"));
+   REQUIRE(!cbor::cpu::parse_level(""));
+}
+
+TEST_CASE("CPU dispatch - level selection", "[cpu_dispatch]") {
+   REQUIRE(cbor::cpu::active_level() <= cbor::cpu::detected_level());
+   REQUIRE(cbor::cpu::active_kernels().tier == cbor::cpu::active_level());
+
+   const char *requested = std::getenv("CBOR_CPU_LEVEL");
+   if (requested && cbor::cpu::parse_level(requested)) {
+      REQUIRE(cbor::cpu::active_level() == std::min(*cbor::cpu::parse_level(requested), cbor::cpu::detected_level()));
+   } else {
+      REQUIRE(cbor::cpu::active_level() == cbor::cpu::detected_level());
+   }
+
+   // Unsupported levels fall back to the detected one
+   REQUIRE(cbor::cpu::kernels_for(cbor::cpu::level::avx512).tier == cbor::cpu::detected_level());
+   REQUIRE(cbor::cpu::kernels_for(cbor::cpu::level::baseline).tier == cbor::cpu::level::baseline);
+}
+
+TEST_CASE("CPU dispatch - max kernels", "[cpu_dispatch]") {
+   for (const auto l : supported_levels()) {
+      INFO("Level: " << cbor::cpu::to_string(l));
+
+      const auto &k = cbor::cpu::kernels_for(l);
+      REQUIRE(k.tier == l);
+
+      check_max_kernel<std::uint8_t>(k.max_u8);
+      check_max_kernel<std::uint16_t>(k.max_u16);
+      check_max_kernel<std::uint32_t>(k.max_u32);
+      check_max_kernel<std::uint64_t>(k.max_u64);
+   }
+}
+
+TEST_CASE("CPU dispatch - small integer run kernels", "[cpu_dispatch]") {
+   for (const auto l : supported_levels()) {
+      INFO("Level: " << cbor::cpu::to_string(l));
+      check_small_int_run_kernel(cbor::cpu::kernels_for(l).small_int_run);
+   }
+}
+
+TEST_CASE("CPU dispatch - bulk encoding of small unsigned integers", "[cpu_dispatch, encoding, array]") {
+   // 100 small elements: written in more than one chunk
+   std::vector<std::uint32_t> small(100);
+   for (std::size_t i = 0; i < small.size(); ++i) {
+      small[i] = static_cast<std::uint32_t>(i % 24);
+   }
+
+   std::vector<std::byte> expected{0x98_b, 0x64_b};
+   for (const auto e : small) {
+      expected.push_back(static_cast<std::byte>(e));
+   }
+
+   std::vector<std::byte> target{};
+   cbor::dynamic_buffer buf{target};
+   REQUIRE(!cbor::encode(buf, small));
+   REQUIRE(target == expected);
+
+   std::vector<std::uint32_t> decoded{};
+   cbor::read_buffer rb{target};
+   REQUIRE(!cbor::decode(rb, decoded));
+   REQUIRE(decoded == small);
+
+   std::array<std::uint32_t, 100> decoded_array{};
+   rb.reset();
+   REQUIRE(!cbor::decode(rb, decoded_array));
+   REQUIRE(std::ranges::equal(decoded_array, small));
+}
+
+TEST_CASE("CPU dispatch - bulk decoding falls back for larger values", "[cpu_dispatch, decoding, array]") {
+   // [1, 24, 2]: the second element takes two bytes, so the bulk check has to fail
+   const std::initializer_list<std::uint8_t> mixed{0x83, 0x01, 0x18, 0x18, 0x02};
+   check_encoding(std::vector<std::uint64_t>{1, 24, 2}, mixed);
+
+   auto bytes = as_bytes(mixed);
+   cbor::read_buffer buf{bytes};
+   std::vector<std::uint64_t> v{};
+   REQUIRE(!cbor::decode(buf, v));
+   REQUIRE(v == std::vector<std::uint64_t>{1, 24, 2});
+
+   // [1, 2, 3] followed by a larger value: only the array elements are checked
+   const std::initializer_list<std::uint8_t> followed{0x83, 0x01, 0x02, 0x03, 0x19, 0x01, 0xF4};
+   auto followed_bytes = as_bytes(followed);
+   cbor::read_buffer followed_buf{followed_bytes};
+   std::vector<std::uint16_t> small{};
+   std::uint16_t next{};
+   REQUIRE(!cbor::decode(followed_buf, small));
+   REQUIRE(!cbor::decode(followed_buf, next));
+   REQUIRE(small == std::vector<std::uint16_t>{1, 2, 3});
+   REQUIRE(next == 500);
+
+   // Truncated input is still reported as an underflow
+   const std::initializer_list<std::uint8_t> truncated{0x83, 0x01, 0x02};
+   auto truncated_bytes = as_bytes(truncated);
+   cbor::read_buffer truncated_buf{truncated_bytes};
+   REQUIRE(cbor::decode(truncated_buf, small) == cbor::error::buffer_underflow);
+}
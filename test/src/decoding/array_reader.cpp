@@ -0,0 +1,158 @@
+/**
+ * @file   array_reader.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ *
+ * Ensure that array elements are decoded one at a time, and that the reader can be stopped early.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <test/decoding.h>
+
+#include <cbor/array_reader.h>
+
+#include <map>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <vector>
+
+using namespace test;
+
+static_assert(std::ranges::input_range<cbor::array_reader<int>>);
+
+TEST_CASE("Array reader - iterating", "[decoding, array_reader]") {
+   std::vector<std::int64_t> values(100000);
+   std::iota(values.begin(), values.end(), -50000);
+
+   auto bytes = encode_to_vector(values);
+
+   // Followed by another item
+   cbor::dynamic_buffer buf{bytes};
+   REQUIRE(!cbor::encode(buf, "tail"));
+
+   cbor::read_buffer read_buf{bytes};
+   cbor::array_reader<std::int64_t> reader{};
+   REQUIRE(!reader.open(read_buf));
+   REQUIRE(reader.size() == values.size());
+
+   std::size_t idx = 0;
+   for (const auto v : reader) {
+      REQUIRE(v == values[idx++]);
+   }
+
+   REQUIRE(idx == values.size());
+   REQUIRE(reader.remaining() == 0);
+   REQUIRE(!reader.last_error());
+
+   std::string tail{};
+   REQUIRE(!cbor::decode(read_buf, tail));
+   REQUIRE(tail == "tail");
+}
+
+TEST_CASE("Array reader - early exit", "[decoding, array_reader]") {
+   const std::vector<std::string> values{"one", "two", "three", "four"};
+   auto bytes = encode_to_vector(values);
+
+   cbor::dynamic_buffer buf{bytes};
+   REQUIRE(!cbor::encode(buf, 42));
+
+   cbor::read_buffer read_buf{bytes};
+   cbor::array_reader<std::string> reader{};
+   REQUIRE(!reader.open(read_buf));
+
+   for (const auto &v : reader) {
+      if (v == "two") {
+         break;
+      }
+   }
+   REQUIRE(reader.remaining() == 2);
+
+   std::string v{};
+   REQUIRE(!reader.next(v));
+   REQUIRE(v == "three");
+
+   REQUIRE(!reader.skip_rest());
+   REQUIRE(reader.remaining() == 0);
+   REQUIRE(reader.next(v) == cbor::error::invalid_usage);
+
+   int after{};
+   REQUIRE(!cbor::decode(read_buf, after));
+   REQUIRE(after == 42);
+
+   SECTION("Range adaptors") {
+      read_buf.reset();
+      REQUIRE(!reader.open(read_buf));
+
+      std::vector<std::size_t> lengths{};
+      for (const auto l : reader | std::views::transform([](const std::string &s) { return s.size(); })) {
+         lengths.push_back(l);
+      }
+      REQUIRE(lengths == std::vector<std::size_t>{3, 3, 5, 4});
+   }
+}
+
+TEST_CASE("Array reader - elements don't share state", "[decoding, array_reader]") {
+   const std::vector<std::map<int, int>> values{{{1, 10}, {2, 20}}, {{3, 30}}};
+   const auto bytes = encode_to_vector(values);
+
+   cbor::read_buffer buf{bytes};
+   cbor::array_reader<std::map<int, int>> reader{};
+   REQUIRE(!reader.open(buf));
+
+   // Same result as when decoding the whole vector
+   std::vector<std::map<int, int>> decoded{};
+   for (const auto &v : reader) {
+      decoded.push_back(v);
+   }
+   REQUIRE(decoded == values);
+
+   SECTION("Explicit decoding into a used value") {
+      buf.reset();
+      REQUIRE(!reader.open(buf));
+
+      std::map<int, int> v{{4, 40}};
+      REQUIRE(!reader.next(v));
+      REQUIRE(v == values[0]);
+      REQUIRE(!reader.next(v));
+      REQUIRE(v == values[1]);
+   }
+}
+
+TEST_CASE("Array reader - errors", "[decoding, array_reader]") {
+   cbor::array_reader<std::uint8_t> reader{};
+
+   SECTION("Not an array") {
+      const auto bytes = encode_to_vector(10);
+      cbor::read_buffer buf{bytes};
+      REQUIRE(reader.open(buf) == cbor::error::unexpected_type);
+      REQUIRE(buf.read_position() == 0);
+   }
+
+   SECTION("Element decoding failure stops the iteration") {
+      const auto bytes = encode_to_vector(std::vector<int>{1, 2, 300, 4});
+      cbor::read_buffer buf{bytes};
+      REQUIRE(!reader.open(buf));
+
+      std::vector<std::uint8_t> decoded{};
+      for (const auto v : reader) {
+         decoded.push_back(v);
+      }
+
+      REQUIRE(decoded == std::vector<std::uint8_t>{1, 2});
+      REQUIRE(reader.last_error() == cbor::error::value_not_representable);
+      REQUIRE(reader.remaining() == 0);
+   }
+
+   SECTION("Truncated array") {
+      auto bytes = encode_to_vector(std::vector<int>{1, 2, 3});
+      bytes.pop_back();
+
+      cbor::read_buffer buf{bytes};
+      REQUIRE(!reader.open(buf));
+      REQUIRE(reader.size() == 3);
+      REQUIRE(reader.skip_rest() == cbor::error::buffer_underflow);
+      REQUIRE(reader.last_error() == cbor::error::buffer_underflow);
+   }
+}
@@ -0,0 +1,119 @@
+/**
+ * @file   bit_vectors.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <test/decoding.h>
+
+#include <cbor/decoding.h>
+
+#include <bitset>
+#include <vector>
+
+using namespace test;
+
+TEST_CASE("Bit vectors - vector error cases", "[decoding, bit_vector, vector, errors]") {
+   SECTION("Not enough data to read head") {
+      std::array<std::byte, 2> source{};
+      cbor::read_buffer buf{span_t{source.data(), 0}};
+
+      std::vector<bool> v;
+      REQUIRE(cbor::decode(buf, v) == cbor::error::buffer_underflow);
+   }
+
+   SECTION("Invalid type") {
+      std::array source{0x82_b, 0xF5_b, 0xF4_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      std::vector<bool> v;
+      REQUIRE(cbor::decode(buf, v) == cbor::error::unexpected_type);
+   }
+
+   SECTION("Missing unused bits count") {
+      std::array source{0x40_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      std::vector<bool> v;
+      REQUIRE(cbor::decode(buf, v) == cbor::error::decoding_error);
+   }
+
+   SECTION("Invalid unused bits count") {
+      std::array source{0x42_b, 0x08_b, 0xFF_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      std::vector<bool> v;
+      REQUIRE(cbor::decode(buf, v) == cbor::error::decoding_error);
+   }
+
+   SECTION("Unused bits without data") {
+      std::array source{0x41_b, 0x01_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      std::vector<bool> v;
+      REQUIRE(cbor::decode(buf, v) == cbor::error::decoding_error);
+   }
+
+   SECTION("Not enough data") {
+      std::array source{0x43_b, 0x00_b, 0xFF_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      std::vector<bool> v;
+      REQUIRE(cbor::decode(buf, v) == cbor::error::buffer_underflow);
+      REQUIRE(v.empty());
+   }
+
+   SECTION("Size above max size") {
+      std::array source{0x42_b, 0x05_b, 0x05_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      std::vector<bool> v;
+      REQUIRE(cbor::decode(buf, v, 2) == cbor::error::buffer_overflow);
+   }
+}
+
+TEST_CASE("Bit vectors - bitset error cases", "[decoding, bit_vector, errors]") {
+   SECTION("Size above the bitset size") {
+      std::array source{0x42_b, 0x05_b, 0x05_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      std::bitset<2> v{};
+      REQUIRE(cbor::decode(buf, v) == cbor::error::buffer_overflow);
+   }
+
+   SECTION("Size below the bitset size") {
+      std::array source{0x42_b, 0x05_b, 0x05_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      std::bitset<4> v{};
+      REQUIRE(cbor::decode(buf, v) == cbor::error::buffer_underflow);
+   }
+}
+
+TEST_CASE("Bit vectors - basic decoding", "[decoding, bit_vector]") {
+   expect({0x41, 0x00}, std::vector<bool>{});
+   expect({0x42, 0x05, 0x05}, std::vector<bool>{true, false, true});
+   expect({0x43, 0x07, 0xFF, 0x01}, std::vector<bool>(9, true));
+
+   expect({0x43, 0x06, 0xA5, 0x02}, std::bitset<10>{0x2A5});
+   expect({0x41, 0x00}, std::bitset<0>{});
+   expect({0x49, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, std::bitset<64>{~0ULL});
+
+   std::bitset<100> large{};
+   large.set(0);
+   large.set(99);
+   expect({0x4E, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08}, large);
+
+   SECTION("Vectors and bitsets of the same size are interchangeable") {
+      std::vector<std::byte> bytes{};
+      cbor::dynamic_buffer buf{bytes};
+      REQUIRE(!cbor::encode(buf, std::vector<bool>{true, false, true, true, false, false, true, false, true, false}));
+
+      std::bitset<10> v{};
+      cbor::read_buffer read_buf{bytes};
+      REQUIRE(!cbor::decode(read_buf, v));
+      REQUIRE(v == std::bitset<10>{0b0101001101});
+   }
+}
@@ -13,6 +13,16 @@
 
 using namespace test;
 
+namespace {
+
+//! Byte-like type, opting in into the byte string encoding
+enum class octet : std::uint8_t {};
+
+} // namespace
+
+template <>
+struct cbor::is_byte<octet> : std::bool_constant<true> {};
+
 using vec_t = std::vector<std::byte>;
 using array_t = std::array<std::byte, 4>;
 
@@ -94,6 +104,34 @@ TEST_CASE("Byte arrays - vector basic decoding", "[decoding, byte_array, vector]
    expect_vector({0x44, 0x01, 0x02, 0x03, 0x04}, {0x01, 0x02, 0x03, 0x04});
 }
 
+TEST_CASE("Byte arrays - large vector decoding", "[decoding, byte_array, vector]") {
+   std::vector<std::byte> source(1024 * 1024 + 1);
+   for (std::size_t i = 0; i < source.size(); ++i) {
+      source[i] = static_cast<std::byte>(i * 31);
+   }
+
+   std::vector<std::byte> bytes{};
+   cbor::dynamic_buffer buf{bytes};
+   REQUIRE(!cbor::encode(buf, cbor::buffer::const_span_t{source}));
+
+   SECTION("Previous contents are replaced") {
+      std::vector<std::byte> v(16, std::byte{0xAA});
+      cbor::read_buffer read_buf{bytes};
+      REQUIRE(!cbor::decode(read_buf, v));
+      REQUIRE(v == source);
+      REQUIRE(read_buf.read_position() == bytes.size());
+   }
+
+   SECTION("Truncated input leaves the vector untouched") {
+      const std::vector<std::byte> original(16, std::byte{0xAA});
+      auto v = original;
+
+      cbor::read_buffer read_buf{span_t{bytes.data(), bytes.size() - 1}};
+      REQUIRE(cbor::decode(read_buf, v) == cbor::error::buffer_underflow);
+      REQUIRE(v == original);
+   }
+}
+
 template <std::size_t Extent>
 void expect_array(std::initializer_list<std::uint8_t> cbor, std::initializer_list<std::uint8_t> expected) {
    INFO("Decoding '" << hex(cbor) << "' into '" << hex(expected) << "'");
@@ -114,3 +152,86 @@ TEST_CASE("Byte arrays - array basic decoding", "[decoding, byte_array, array]")
    expect_array<0>({0x40}, {});
    expect_array<4>({0x44, 0x01, 0x02, 0x03, 0x04}, {0x01, 0x02, 0x03, 0x04});
 }
+
+TEST_CASE("Byte arrays - byte-like types", "[decoding, byte_array]") {
+   const std::vector<octet> source{octet{0x01}, octet{0xC8}};
+
+   std::vector<std::byte> bytes{};
+   cbor::dynamic_buffer buf{bytes};
+
+   // h'01C8' instead of [1, 200]
+   REQUIRE(!cbor::encode(buf, source));
+   REQUIRE(bytes == as_bytes(std::vector<std::uint8_t>{0x42, 0x01, 0xC8}));
+
+   SECTION("Vector") {
+      cbor::read_buffer read_buf{bytes};
+
+      std::vector<octet> v{};
+      REQUIRE(!cbor::decode(read_buf, v));
+      REQUIRE(v == source);
+   }
+
+   SECTION("Array") {
+      cbor::read_buffer read_buf{bytes};
+
+      std::array<octet, 2> v{};
+      REQUIRE(!cbor::decode(read_buf, v));
+      REQUIRE(v[0] == source[0]);
+      REQUIRE(v[1] == source[1]);
+   }
+
+   SECTION("Array encoding") {
+      const std::array<octet, 2> v{octet{0x01}, octet{0xC8}};
+
+      std::vector<std::byte> target{};
+      cbor::dynamic_buffer target_buf{target};
+      REQUIRE(!cbor::encode(target_buf, v));
+      REQUIRE(target == bytes);
+   }
+}
+
+TEST_CASE("Byte arrays - decoding into a caller-provided memory", "[decoding, byte_array]") {
+   std::array<std::byte, 4> out{};
+   std::size_t len = 0;
+
+   SECTION("Shorter than the target") {
+      std::array source{0x42_b, 0x01_b, 0x02_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      REQUIRE(!cbor::decode(buf, std::span{out}, len));
+      REQUIRE(len == 2);
+      REQUIRE(out[0] == 0x01_b);
+      REQUIRE(out[1] == 0x02_b);
+      REQUIRE(buf.read_position() == source.size());
+   }
+
+   SECTION("Exactly the target size") {
+      std::array source{0x44_b, 0x01_b, 0x02_b, 0x03_b, 0x04_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      REQUIRE(!cbor::decode(buf, std::span{out}, len));
+      REQUIRE(len == 4);
+      REQUIRE(out[3] == 0x04_b);
+   }
+
+   SECTION("Larger than the target") {
+      std::array source{0x45_b, 0x01_b, 0x02_b, 0x03_b, 0x04_b, 0x05_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      REQUIRE(cbor::decode(buf, std::span{out}, len) == cbor::error::buffer_overflow);
+   }
+
+   SECTION("Not enough data") {
+      std::array source{0x43_b, 0x01_b, 0x02_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      REQUIRE(cbor::decode(buf, std::span{out}, len) == cbor::error::buffer_underflow);
+   }
+
+   SECTION("Text strings are not accepted") {
+      std::array source{0x61_b, 0x61_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      REQUIRE(cbor::decode(buf, std::span{out}, len) == cbor::error::unexpected_type);
+   }
+}
@@ -0,0 +1,163 @@
+/**
+ * @file   columnar.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <test/decoding.h>
+
+#include <cbor/decoding.h>
+#include <cbor/schema.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace test;
+
+namespace {
+
+struct sample {
+   std::uint32_t id{};
+   std::string name{};
+   double value{};
+   std::optional<std::int16_t> rank{};
+
+   bool operator==(const sample &) const = default;
+
+   CBOR_FIELDS(sample, id, name, value, rank)
+};
+
+struct sample_columns {
+   std::vector<std::uint32_t> id{};
+   std::vector<std::string> name{};
+   std::vector<double> value{};
+   std::vector<std::optional<std::int16_t>> rank{};
+
+   CBOR_FIELDS(sample_columns, id, name, value, rank)
+};
+
+struct row_sample {
+   std::uint32_t id{};
+   std::string name{};
+   double value{};
+   std::optional<std::int16_t> rank{};
+
+   CBOR_FIELDS(row_sample, id, name, value, rank)
+};
+
+// [[1, "a", 0.5, null], [2, "bc", -1.0, 7]] in columns
+const std::initializer_list<std::uint8_t> two_samples{
+   0x84,                                                  // 4 columns
+   0xD8, 0x46, 0x48, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, // 70(h'0100000002000000')
+   0x82, 0x61, 0x61, 0x62, 0x62, 0x63,                   // ["a", "bc"]
+   0xD8, 0x56, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, // 86(h'000000000000E03F...')
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xBF,       // ...000000000000F0BF)
+   0x82, 0xF6, 0x07,                                     // [null, 7]
+};
+
+template <typename T>
+std::error_code decode_bytes(std::initializer_list<std::uint8_t> cbor, T &v) {
+   const auto bytes = as_bytes(cbor);
+   cbor::read_buffer buf{span_t{bytes}};
+   return cbor::decode(buf, v);
+}
+
+} // namespace
+
+template <>
+struct cbor::is_columnar<sample> : std::true_type {};
+
+TEST_CASE("Columnar - basic decoding", "[decoding, columnar]") {
+   expect(two_samples, std::vector<sample>{{1, "a", 0.5, std::nullopt}, {2, "bc", -1.0, 7}});
+   expect({0x84, 0xD8, 0x46, 0x40, 0x80, 0xD8, 0x56, 0x40, 0x80}, std::vector<sample>{});
+
+   // Existing elements are overwritten
+   std::vector<sample> v(5);
+   REQUIRE(!decode_bytes(two_samples, v));
+   REQUIRE(v == std::vector<sample>{{1, "a", 0.5, std::nullopt}, {2, "bc", -1.0, 7}});
+
+   // Trusted decoding shares the columnar decoder
+   const auto bytes = as_bytes(two_samples);
+   cbor::read_buffer buf{span_t{bytes}};
+   std::vector<sample> trusted{};
+   REQUIRE(!cbor::decode_trusted(buf, trusted));
+   REQUIRE(trusted == v);
+}
+
+TEST_CASE("Columnar - decoding into a struct of arrays", "[decoding, columnar]") {
+   const auto bytes = as_bytes(two_samples);
+   cbor::read_buffer buf{span_t{bytes}};
+
+   sample_columns columns{};
+   REQUIRE(!cbor::decode_columns(buf, columns));
+   REQUIRE(buf.read_position() == static_cast<std::ptrdiff_t>(bytes.size()));
+
+   REQUIRE(columns.id == std::vector<std::uint32_t>{1, 2});
+   REQUIRE(columns.name == std::vector<std::string>{"a", "bc"});
+   REQUIRE(columns.value == std::vector<double>{0.5, -1.0});
+   REQUIRE(columns.rank == std::vector<std::optional<std::int16_t>>{std::nullopt, 7});
+}
+
+TEST_CASE("Columnar - schema fingerprint", "[decoding, columnar, schema]") {
+   // Same members, different encoding
+   STATIC_REQUIRE(cbor::schema_fingerprint_v<sample> == cbor::schema_fingerprint_v<row_sample>);
+   STATIC_REQUIRE(cbor::schema_fingerprint_v<std::vector<sample>> !=
+                  cbor::schema_fingerprint_v<std::vector<row_sample>>);
+}
+
+TEST_CASE("Columnar - decoding error cases", "[decoding, columnar, errors]") {
+   std::vector<sample> v{};
+   sample_columns columns{};
+
+   SECTION("Rows instead of columns") {
+      REQUIRE(decode_bytes({0x81, 0x84, 0x01, 0x61, 0x61, 0xF9, 0x38, 0x00, 0xF6}, v) ==
+              cbor::error::decoding_error);
+   }
+
+   SECTION("Invalid number of columns") {
+      REQUIRE(decode_bytes({0x83, 0xD8, 0x46, 0x40, 0x80, 0xD8, 0x56, 0x40}, v) == cbor::error::decoding_error);
+      REQUIRE(decode_bytes({0x83, 0xD8, 0x46, 0x40, 0x80, 0xD8, 0x56, 0x40}, columns) ==
+              cbor::error::decoding_error);
+   }
+
+   SECTION("Invalid typed array tag") {
+      // 69(h'') instead of 70(h'')
+      REQUIRE(decode_bytes({0x84, 0xD8, 0x45, 0x40, 0x80, 0xD8, 0x56, 0x40, 0x80}, v) ==
+              cbor::error::unexpected_type);
+   }
+
+   SECTION("Typed array length is not a multiple of the element size") {
+      REQUIRE(decode_bytes({0x84, 0xD8, 0x46, 0x43, 0x01, 0x00, 0x00, 0x80, 0xD8, 0x56, 0x40, 0x80}, v) ==
+              cbor::error::decoding_error);
+   }
+
+   SECTION("Column sizes don't match") {
+      // 70(h'01000000'), [], ...
+      const std::initializer_list<std::uint8_t> mismatch{0x84, 0xD8, 0x46, 0x44, 0x01, 0x00, 0x00,
+                                                         0x00, 0x80, 0xD8, 0x56, 0x40, 0x80};
+      REQUIRE(decode_bytes(mismatch, v) == cbor::error::decoding_error);
+
+      const auto bytes = as_bytes(mismatch);
+      cbor::read_buffer buf{span_t{bytes}};
+      REQUIRE(cbor::decode_columns(buf, columns) == cbor::error::decoding_error);
+   }
+
+   SECTION("Column size exceeds the input") {
+      // 70(h'...') with 0xFFFFFFF8 bytes
+      REQUIRE(decode_bytes({0x84, 0xD8, 0x46, 0x5A, 0xFF, 0xFF, 0xFF, 0xF8, 0x00}, v) ==
+              cbor::error::buffer_underflow);
+
+      // Array of 0xFFFFFFFF strings
+      REQUIRE(decode_bytes({0x84, 0xD8, 0x46, 0x40, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF}, v) ==
+              cbor::error::buffer_underflow);
+   }
+
+   SECTION("Too many elements") {
+      const auto bytes = as_bytes(two_samples);
+      cbor::read_buffer buf{span_t{bytes}};
+      REQUIRE(cbor::decode(buf, v, 1) == cbor::error::buffer_overflow);
+   }
+}
@@ -0,0 +1,182 @@
+/**
+ * @file   event_parser.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <test/decoding.h>
+
+#include <cbor/event_parser.h>
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace test;
+
+namespace {
+
+//! Records all the events as a single string
+struct recorder {
+   void on_uint(std::uint64_t v) { os << "u" << v << " "; }
+   void on_int(std::int64_t v) { os << "i" << v << " "; }
+   void on_bytes(std::span<const std::byte> v) { os << "h'" << hex(std::vector<std::byte>{v.begin(), v.end()}) << "' "; }
+   void on_string(std::string_view v) { os << "\"" << v << "\" "; }
+   void on_array_begin(std::uint64_t size) { os << "[" << size << " "; }
+   void on_array_end() { os << "] "; }
+   void on_map_begin(std::uint64_t size) { os << "{" << size << " "; }
+   void on_map_end() { os << "} "; }
+   void on_tag(std::uint64_t v) { os << "t" << v << " "; }
+   void on_bool(bool v) { os << (v ? "true " : "false "); }
+   void on_null() { os << "null "; }
+   void on_undefined() { os << "undefined "; }
+   void on_float(double v) { os << "f" << v << " "; }
+   void on_simple(std::uint8_t v) { os << "s" << static_cast<unsigned>(v) << " "; }
+
+   std::ostringstream os{};
+};
+
+void expect_events(std::initializer_list<std::uint8_t> cbor, const std::string &expected) {
+   INFO("Parsing '" << hex(cbor) << "'");
+
+   const auto cbor_bytes = as_bytes(cbor);
+   cbor::read_buffer buf{span_t{cbor_bytes}};
+
+   recorder r{};
+   REQUIRE(cbor::parse(buf, r) == cbor::error::success);
+   REQUIRE(r.os.str() == expected);
+   REQUIRE(buf.read_position() == cbor_bytes.size());
+}
+
+template <std::size_t MaxDepth = cbor::default_max_parse_depth>
+void expect_error(std::initializer_list<std::uint8_t> cbor, cbor::error expected) {
+   INFO("Parsing '" << hex(cbor) << "'");
+
+   const auto cbor_bytes = as_bytes(cbor);
+   cbor::read_buffer buf{span_t{cbor_bytes}};
+
+   recorder r{};
+   REQUIRE(cbor::parse<MaxDepth>(buf, r) == expected);
+}
+
+} // namespace
+
+TEST_CASE("Event parser - simple items", "[decoding, event_parser]") {
+   expect_events({0x17}, "u23 ");
+   expect_events({0x19, 0x01, 0xF4}, "u500 ");
+   expect_events({0x39, 0x01, 0xF3}, "i-500 ");
+   expect_events({0xF4}, "false ");
+   expect_events({0xF5}, "true ");
+   expect_events({0xF6}, "null ");
+   expect_events({0xF7}, "undefined ");
+   expect_events({0xF0}, "s16 ");
+   expect_events({0xF8, 0xFF}, "s255 ");
+   expect_events({0xF9, 0x3C, 0x00}, "f1 ");
+   expect_events({0xFA, 0x47, 0xC3, 0x50, 0x00}, "f100000 ");
+   expect_events({0xFB, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, "f1.5 ");
+   expect_events({0x44, 0x01, 0x02, 0x03, 0x04}, "h'01020304' ");
+   expect_events({0x63, 0x61, 0x62, 0x63}, "\"abc\" ");
+   expect_events({0x60}, "\"\" ");
+}
+
+TEST_CASE("Event parser - nested items", "[decoding, event_parser]") {
+   // [1, [2, 3], {"a": [4]}]
+   expect_events({0x83, 0x01, 0x82, 0x02, 0x03, 0xA1, 0x61, 0x61, 0x81, 0x04},
+                 "[3 u1 [2 u2 u3 ] {1 \"a\" [1 u4 ] } ] ");
+
+   // 1(1363896240) - tagged epoch time
+   expect_events({0xC1, 0x1A, 0x51, 0x4B, 0x67, 0xB0}, "t1 u1363896240 ");
+
+   // [0(1), 2]
+   expect_events({0x82, 0xC0, 0x01, 0x02}, "[2 t0 u1 u2 ] ");
+
+   // Empty containers
+   expect_events({0x80}, "[0 ] ");
+   expect_events({0xA0}, "{0 } ");
+   expect_events({0x82, 0x80, 0xA0}, "[2 [0 ] {0 } ] ");
+
+   SECTION("Only a single item is parsed") {
+      const auto cbor_bytes = as_bytes(std::initializer_list<std::uint8_t>{0x81, 0x01, 0x02});
+      cbor::read_buffer buf{span_t{cbor_bytes}};
+
+      recorder r{};
+      REQUIRE(cbor::parse(buf, r) == cbor::error::success);
+      REQUIRE(r.os.str() == "[1 u1 ] ");
+      REQUIRE(buf.read_position() == 2);
+   }
+}
+
+TEST_CASE("Event parser - partial handlers", "[decoding, event_parser]") {
+   struct string_stats {
+      void on_string(std::string_view v) {
+         ++count;
+         total_size += v.size();
+      }
+
+      std::size_t count{0};
+      std::size_t total_size{0};
+   };
+
+   std::vector<std::byte> bytes{};
+   cbor::dynamic_buffer buf{bytes};
+
+   const std::map<std::string, std::vector<std::string>> v{{"a", {"one", "two"}}, {"bb", {}}, {"ccc", {"three"}}};
+   REQUIRE(!cbor::encode(buf, v));
+
+   cbor::read_buffer read_buf{bytes};
+   string_stats stats{};
+   REQUIRE(!cbor::parse(read_buf, stats));
+   REQUIRE(stats.count == 6);
+   REQUIRE(stats.total_size == 17);
+}
+
+TEST_CASE("Event parser - stopping early", "[decoding, event_parser]") {
+   struct find_first {
+      std::error_code on_uint(std::uint64_t v) {
+         if (v > 10) {
+            found = v;
+            return cbor::error::not_found;
+         }
+         return cbor::error::success;
+      }
+
+      std::uint64_t found{0};
+   };
+
+   // [1, [20, 30]]
+   const auto cbor_bytes = as_bytes(std::initializer_list<std::uint8_t>{0x82, 0x01, 0x82, 0x14, 0x18, 0x1E});
+   cbor::read_buffer buf{span_t{cbor_bytes}};
+
+   find_first handler{};
+   REQUIRE(cbor::parse(buf, handler) == cbor::error::not_found);
+   REQUIRE(handler.found == 20);
+   REQUIRE(buf.read_position() == 4);
+}
+
+TEST_CASE("Event parser - errors", "[decoding, event_parser]") {
+   // Truncated items
+   expect_error({0x19, 0x01}, cbor::error::buffer_underflow);
+   expect_error({0x44, 0x01, 0x02}, cbor::error::buffer_underflow);
+   expect_error({0x83, 0x01, 0x02}, cbor::error::buffer_underflow);
+   expect_error({0xA2, 0x01, 0x02}, cbor::error::buffer_underflow);
+   expect_error({0xC1}, cbor::error::buffer_underflow);
+
+   // Indefinite-length items are not supported
+   expect_error({0x9F, 0x01, 0xFF}, cbor::error::decoding_error);
+   expect_error({0x7F, 0x61, 0x61, 0xFF}, cbor::error::decoding_error);
+
+   // Ill-formed items
+   expect_error({0x1C}, cbor::error::ill_formed);
+   expect_error({0x1F}, cbor::error::ill_formed);
+   expect_error({0xFF}, cbor::error::ill_formed);
+
+   // Negative integers, not fitting into a std::int64_t
+   expect_error({0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, cbor::error::value_not_representable);
+
+   // Nesting deeper than supported
+   expect_error<2>({0x81, 0x81, 0x01}, cbor::error::success);
+   expect_error<2>({0x81, 0x81, 0x81, 0x01}, cbor::error::decoding_error);
+}
@@ -0,0 +1,164 @@
+/**
+ * @file   fixed_capacity.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <test/decoding.h>
+
+#include <cbor/fixed_string.h>
+#include <cbor/schema.h>
+#include <cbor/static_vector.h>
+
+#include <string>
+#include <vector>
+
+using namespace test;
+
+namespace {
+
+struct level {
+   std::int64_t price;
+   std::uint32_t quantity;
+
+   CBOR_FIELDS(level, price, quantity)
+};
+
+bool operator==(const level &lhs, const level &rhs) {
+   return lhs.price == rhs.price && lhs.quantity == rhs.quantity;
+}
+
+struct quote {
+   std::string symbol;
+   std::vector<level> levels;
+   std::vector<std::byte> signature;
+
+   CBOR_FIELDS(quote, symbol, levels, signature)
+};
+
+//! Same as quote, but without any heap allocations
+struct static_quote {
+   cbor::fixed_string<8> symbol;
+   cbor::static_vector<level, 4> levels;
+   cbor::static_vector<std::byte, 4> signature;
+
+   CBOR_FIELDS(static_quote, symbol, levels, signature)
+};
+
+} // namespace
+
+// Fixed-capacity containers share the encoding with the dynamic ones
+static_assert(cbor::schema_fingerprint_v<quote> == cbor::schema_fingerprint_v<static_quote>);
+
+TEST_CASE("Fixed capacity - fixed string", "[decoding, fixed_capacity]") {
+   constexpr cbor::fixed_string<4> literal{"abc"};
+   static_assert(literal.size() == 3);
+   static_assert(literal.view() == "abc");
+
+   SECTION("Same encoding as std::string") {
+      REQUIRE(encode_to_vector(literal) == encode_to_vector(std::string{"abc"}));
+   }
+
+   SECTION("Decoding") {
+      const auto bytes = encode_to_vector(std::string{"abcd"});
+      cbor::read_buffer buf{bytes};
+
+      cbor::fixed_string<4> v{"x"};
+      REQUIRE(!cbor::decode(buf, v));
+      REQUIRE(v == "abcd");
+   }
+
+   SECTION("Overflow") {
+      const auto bytes = encode_to_vector(std::string{"abcde"});
+      cbor::read_buffer buf{bytes};
+
+      cbor::fixed_string<4> v{"x"};
+      REQUIRE(cbor::decode(buf, v) == cbor::error::buffer_overflow);
+      REQUIRE(v == "x");
+   }
+
+   SECTION("Assignment") {
+      cbor::fixed_string<4> v{};
+      REQUIRE(!v.assign("abcd"));
+      REQUIRE(v == "abcd");
+      REQUIRE(v.assign("abcde") == cbor::error::buffer_overflow);
+      REQUIRE(v == "abcd");
+   }
+}
+
+TEST_CASE("Fixed capacity - static vector", "[decoding, fixed_capacity]") {
+   cbor::static_vector<std::uint16_t, 3> v{};
+   REQUIRE(!v.push_back(1));
+   REQUIRE(!v.push_back(1000));
+   REQUIRE(!v.push_back(3));
+   REQUIRE(v.push_back(4) == cbor::error::buffer_overflow);
+
+   SECTION("Same encoding as std::vector") {
+      REQUIRE(encode_to_vector(v) == encode_to_vector(std::vector<std::uint16_t>{1, 1000, 3}));
+   }
+
+   SECTION("Decoding") {
+      const auto bytes = encode_to_vector(std::vector<std::uint16_t>{5, 6});
+      cbor::read_buffer buf{bytes};
+
+      REQUIRE(!cbor::decode(buf, v));
+      REQUIRE(v.size() == 2);
+      REQUIRE(v[0] == 5);
+      REQUIRE(v[1] == 6);
+   }
+
+   SECTION("Overflow") {
+      const auto bytes = encode_to_vector(std::vector<std::uint16_t>{1, 2, 3, 4});
+      cbor::read_buffer buf{bytes};
+
+      REQUIRE(cbor::decode(buf, v) == cbor::error::buffer_overflow);
+      REQUIRE(v.size() == 3);
+   }
+
+   SECTION("Byte elements are encoded as byte strings") {
+      cbor::static_vector<std::byte, 4> bytes{};
+      REQUIRE(!bytes.push_back(0x01_b));
+      REQUIRE(!bytes.push_back(0x02_b));
+      REQUIRE(encode_to_vector(bytes) == as_bytes(std::vector<std::uint8_t>{0x42, 0x01, 0x02}));
+
+      const auto encoded = encode_to_vector(std::vector<std::byte>{0x03_b, 0x04_b, 0x05_b});
+      cbor::read_buffer buf{encoded};
+      REQUIRE(!cbor::decode(buf, bytes));
+      REQUIRE(bytes.size() == 3);
+      REQUIRE(bytes[2] == 0x05_b);
+   }
+}
+
+TEST_CASE("Fixed capacity - struct decoding", "[decoding, fixed_capacity]") {
+   const quote source{
+      .symbol = "ACME",
+      .levels = {{100, 5}, {-101, 7}},
+      .signature = {0xDE_b, 0xAD_b},
+   };
+   const auto bytes = encode_to_vector(source);
+
+   static_quote decoded{};
+   cbor::read_buffer buf{bytes};
+   REQUIRE(!cbor::decode(buf, decoded));
+
+   REQUIRE(decoded.symbol == "ACME");
+   REQUIRE(decoded.levels.size() == 2);
+   REQUIRE(decoded.levels[0] == source.levels[0]);
+   REQUIRE(decoded.levels[1] == source.levels[1]);
+   REQUIRE(std::ranges::equal(decoded.signature, source.signature));
+
+   SECTION("Round trip") {
+      REQUIRE(encode_to_vector(decoded) == bytes);
+   }
+
+   SECTION("Overflow") {
+      quote large = source;
+      large.symbol = "A VERY LONG SYMBOL";
+      const auto large_bytes = encode_to_vector(large);
+
+      cbor::read_buffer large_buf{large_bytes};
+      REQUIRE(cbor::decode(large_buf, decoded) == cbor::error::buffer_overflow);
+   }
+}
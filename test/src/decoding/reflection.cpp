@@ -6,6 +6,7 @@
  * Ensure that
  * - it is possible to provide custom reflection functions when Boost PFR is disabled.
  * - Boost PFR works for bare structs.
+ * - registered fields work for classes with private and inherited members.
  */
 
 #include <catch2/catch_test_macros.hpp>
@@ -14,6 +15,9 @@
 
 #include <test/decoding.h>
 
+#include <optional>
+#include <string>
+
 using namespace test;
 
 namespace {
@@ -54,6 +58,29 @@ bool operator==(const custom_reflection &lhs, const custom_reflection &rhs) {
 }
 
 [[maybe_unused]] consteval void enable_cbor_encoding(custom_reflection);
+
+struct entity {
+   std::uint32_t id{};
+};
+
+class registered_fields : public entity {
+public:
+   registered_fields() = default;
+   registered_fields(std::uint32_t id, std::string name, std::optional<int> rank)
+      : entity{id}
+      , name_{std::move(name)}
+      , rank_{rank} {}
+
+   bool operator==(const registered_fields &o) const {
+      return std::make_tuple(id, name_, rank_) == std::make_tuple(o.id, o.name_, o.rank_);
+   }
+
+private:
+   CBOR_FIELDS(registered_fields, id, name_, rank_)
+
+   std::string name_{};
+   std::optional<int> rank_{};
+};
 } // namespace
 
 #if CBOR_WITH(BOOST_PFR)
@@ -100,6 +127,17 @@ TEST_CASE("Struct - decoding with custom reflection", "[decoding, struct]") {
    expect({0x84, 0x0A, 0x14, 0x42, 0x01, 0x02, 0x42, 0x03, 0x04}, custom_reflection{10, 20, {1_b, 2_b}, {3_b, 4_b}});
 }
 
+TEST_CASE("Struct - decoding with registered fields", "[decoding, struct]") {
+   expect({0x83, 0x07, 0x62, 0x61, 0x62, 0x03}, registered_fields{7, "ab", 3});
+   expect({0x83, 0x07, 0x60, 0xF6}, registered_fields{7, "", std::nullopt});
+
+   // Number of members has to match
+   std::array source{0x82_b, 0x07_b, 0x60_b};
+   cbor::read_buffer buf{span_t{source}};
+   registered_fields v{};
+   REQUIRE(cbor::decode(buf, v));
+}
+
 TEST_CASE("Struct - decoding with custom reflection and rapped in optional", "[decoding, struct]") {
    using optional_t = std::optional<custom_reflection>;
    expect({0x84, 0x0A, 0x14, 0x42, 0x01, 0x02, 0x42, 0x03, 0x04}, optional_t{{10, 20, {1_b, 2_b}, {3_b, 4_b}}});
@@ -0,0 +1,116 @@
+/**
+ * @file   skip.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <test/decoding.h>
+
+#include <cbor/decoding.h>
+
+#include <vector>
+
+using namespace test;
+
+namespace {
+
+void expect_skipped(std::initializer_list<std::uint8_t> cbor, std::size_t expected_position) {
+   INFO("Skipping '" << hex(cbor) << "'");
+
+   const auto cbor_bytes = as_bytes(cbor);
+   cbor::read_buffer buf{span_t{cbor_bytes}};
+
+   REQUIRE(cbor::skip(buf) == cbor::error::success);
+   REQUIRE(buf.read_position() == expected_position);
+}
+
+void expect_error(std::initializer_list<std::uint8_t> cbor, cbor::error expected) {
+   INFO("Skipping '" << hex(cbor) << "'");
+
+   const auto cbor_bytes = as_bytes(cbor);
+   cbor::read_buffer buf{span_t{cbor_bytes}};
+
+   REQUIRE(cbor::skip(buf) == expected);
+}
+
+} // namespace
+
+TEST_CASE("Skip - simple items", "[decoding, skip]") {
+   expect_skipped({0x17, 0xFF}, 1);                               // 23
+   expect_skipped({0x19, 0x01, 0xF4, 0xFF}, 3);                   // 500
+   expect_skipped({0x39, 0x01, 0xF3}, 3);                         // -500
+   expect_skipped({0xF5}, 1);                                     // true
+   expect_skipped({0xF6}, 1);                                     // null
+   expect_skipped({0xF9, 0x7E, 0x00}, 3);                         // NaN
+   expect_skipped({0xFB, 0x3F, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A}, 9); // 1.1
+   expect_skipped({0x44, 0x01, 0x02, 0x03, 0x04, 0x00}, 5);       // h'01020304'
+   expect_skipped({0x63, 0x61, 0x62, 0x63}, 4);                   // "abc"
+}
+
+TEST_CASE("Skip - nested items", "[decoding, skip]") {
+   // [1, [2, 3], {"a": [4]}]
+   expect_skipped({0x83, 0x01, 0x82, 0x02, 0x03, 0xA1, 0x61, 0x61, 0x81, 0x04, 0x00}, 10);
+
+   // 1(1363896240) - tagged epoch time
+   expect_skipped({0xC1, 0x1A, 0x51, 0x4B, 0x67, 0xB0}, 6);
+
+   // Empty containers
+   expect_skipped({0x80, 0x01}, 1);
+   expect_skipped({0xA0, 0x01}, 1);
+}
+
+TEST_CASE("Skip - integer arrays", "[decoding, skip]") {
+   // Runs of single-byte integers are skipped in bulk, interrupted by larger values and nested items
+   std::vector<std::int64_t> values(1000);
+   for (std::size_t i = 0; i < values.size(); ++i) {
+      values[i] = (i % 97 == 0) ? 100000 : static_cast<std::int64_t>(i % 48) - 24;
+   }
+
+   const std::vector<std::vector<std::int64_t>> nested{values, {}, {1, 2, 3}, values};
+
+   for (const auto &bytes : {encode_to_vector(values), encode_to_vector(nested)}) {
+      std::vector<std::byte> followed = bytes;
+      followed.push_back(0x01_b);
+
+      cbor::read_buffer buf{span_t{followed}};
+      REQUIRE(!cbor::skip(buf));
+      REQUIRE(buf.read_position() == bytes.size());
+
+      // Truncated arrays
+      cbor::read_buffer truncated{span_t{bytes}.first(bytes.size() - 1)};
+      REQUIRE(cbor::skip(truncated) == cbor::error::buffer_underflow);
+   }
+}
+
+TEST_CASE("Skip - errors", "[decoding, skip, errors]") {
+   SECTION("Not enough data to read head") {
+      std::array<std::byte, 2> source{};
+      cbor::read_buffer buf{span_t{source.data(), 0}};
+      REQUIRE(cbor::skip(buf) == cbor::error::buffer_underflow);
+   }
+
+   SECTION("Truncated items") {
+      expect_error({0x44, 0x01, 0x02}, cbor::error::buffer_underflow);
+      expect_error({0x83, 0x01, 0x02}, cbor::error::buffer_underflow);
+      expect_error({0xA1, 0x01}, cbor::error::buffer_underflow);
+      expect_error({0xC1}, cbor::error::buffer_underflow);
+   }
+
+   SECTION("Huge item counts") {
+      expect_error({0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, cbor::error::buffer_underflow);
+      expect_error({0xBB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01}, cbor::error::buffer_underflow);
+   }
+
+   SECTION("Ill-formed items") {
+      expect_error({0x1C}, cbor::error::ill_formed);
+      expect_error({0x1F}, cbor::error::ill_formed);
+      expect_error({0xFF}, cbor::error::ill_formed);
+   }
+
+   SECTION("Indefinite-length items are not supported") {
+      expect_error({0x9F, 0x01, 0xFF}, cbor::error::decoding_error);
+      expect_error({0x5F, 0x41, 0x01, 0xFF}, cbor::error::decoding_error);
+   }
+}
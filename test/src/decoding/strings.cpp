@@ -52,3 +52,40 @@ TEST_CASE("Strings - basic decoding", "[decoding, string]") {
    expect({0x62, 0xC3, 0xBC}, "\u00fc"s);
    expect({0x63, 0xE6, 0xB0, 0xB4}, "\u6c34"s);
 }
+
+TEST_CASE("Strings - decoding into a caller-provided memory", "[decoding, string]") {
+   std::array<char, 8> out{};
+   std::size_t len = 0;
+
+   SECTION("Shorter than the target") {
+      std::array source{0x63_b, 0x61_b, 0x62_b, 0x63_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      REQUIRE(!cbor::decode(buf, std::span{out}, len));
+      REQUIRE(std::string_view{out.data(), len} == "abc");
+      REQUIRE(buf.read_position() == source.size());
+   }
+
+   SECTION("Empty string") {
+      std::array source{0x60_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      len = 1;
+      REQUIRE(!cbor::decode(buf, std::span{out}, len));
+      REQUIRE(len == 0);
+   }
+
+   SECTION("Larger than the target") {
+      std::array source{0x69_b, 0x61_b, 0x62_b, 0x63_b, 0x64_b, 0x65_b, 0x66_b, 0x67_b, 0x68_b, 0x69_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      REQUIRE(cbor::decode(buf, std::span{out}, len) == cbor::error::buffer_overflow);
+   }
+
+   SECTION("Byte strings are not accepted") {
+      std::array source{0x41_b, 0x61_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      REQUIRE(cbor::decode(buf, std::span{out}, len) == cbor::error::unexpected_type);
+   }
+}
@@ -80,6 +80,12 @@ struct type_id<variant_b> : std::integral_constant<std::uint64_t, 0xDEAF> {};
    return res;
 }
 
+//! Same alternatives, but encoded as tags
+using tagged_t = std::variant<variant_b, variant_a>;
+
+template <>
+struct is_tagged_variant<tagged_t> : std::true_type {};
+
 } // namespace cbor
 
 static_assert(cbor::type_id_v<variant_a> == 0xBEEF);
@@ -177,3 +183,96 @@ TEST_CASE("Variant - decoding error cases", "[decoding, variant, errors]") {
    }
 }
 
+TEST_CASE("Variant - visiting", "[decoding, variant]") {
+   const std::array source{0x82_b, 0x19_b, 0xDE_b, 0xAF_b, 0xF6_b, 0xF5_b};
+
+   SECTION("Matching alternative is passed to the visitor") {
+      cbor::read_buffer buf{span_t{source}};
+
+      int calls = 0;
+      auto res = cbor::decode_visit<value_t>(buf, [&](const auto &v) {
+         ++calls;
+         if constexpr (std::is_same_v<std::remove_cvref_t<decltype(v)>, variant_b>) {
+            REQUIRE(v == variant_b{.a = std::nullopt, .b = true});
+         } else {
+            FAIL("Unexpected alternative");
+         }
+      });
+
+      REQUIRE(!res);
+      REQUIRE(calls == 1);
+      REQUIRE(buf.read_position() == source.size());
+   }
+
+   SECTION("Visitor errors are propagated") {
+      cbor::read_buffer buf{span_t{source}};
+
+      auto res = cbor::decode_visit<value_t>(buf, [](auto &) -> std::error_code { return cbor::error::invalid_usage; });
+      REQUIRE(res == cbor::error::invalid_usage);
+   }
+
+   SECTION("Unexpected alternative type_id") {
+      std::array source{0x82_b, 0x19_b, 0xBE_b, 0xED_b, 0xF9_b, 0x00_b, 0x00_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      bool called = false;
+      REQUIRE(cbor::decode_visit<value_t>(buf, [&](auto &) { called = true; }) == cbor::error::unexpected_type);
+      REQUIRE(!called);
+   }
+
+   SECTION("Visitor is not called on alternative decoding errors") {
+      std::array source{0x82_b, 0x19_b, 0xBE_b, 0xEF_b, 0x01_b, 0xF9_b, 0x00_b, 0x00_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      bool called = false;
+      REQUIRE(cbor::decode_visit<value_t>(buf, [&](auto &) { called = true; }) == cbor::error::buffer_underflow);
+      REQUIRE(!called);
+   }
+}
+
+TEST_CASE("Variant - tagged decoding", "[decoding, variant]") {
+   const cbor::tagged_t first = variant_a{.a = 1, .b = 0.0, .c = "a"};
+   const cbor::tagged_t second = variant_b{.a = std::nullopt, .b = true};
+
+   expect(
+      {
+         0xD9, 0xBE, 0xEF, // Tag = Type ID
+         0x01,             // a = 1
+         0xF9, 0x00, 0x00, // b = 0.0
+         0x61, 0x61        // c = "a"
+      },
+      first);
+
+   expect(
+      {
+         0xD9, 0xDE, 0xAF, // Tag = Type ID
+         0xF6,             // a = nullopt
+         0xF5,             // b = true
+      },
+      second);
+
+   SECTION("Visiting") {
+      std::array source{0xD9_b, 0xDE_b, 0xAF_b, 0xF6_b, 0xF5_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      bool called = false;
+      REQUIRE(!cbor::decode_visit<cbor::tagged_t>(buf, [&](auto &) { called = true; }));
+      REQUIRE(called);
+   }
+
+   SECTION("Array encoding is not accepted") {
+      std::array source{0x82_b, 0x19_b, 0xDE_b, 0xAF_b, 0xF6_b, 0xF5_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      cbor::tagged_t v;
+      REQUIRE(cbor::decode(buf, v) == cbor::error::unexpected_type);
+   }
+
+   SECTION("Unexpected alternative tag") {
+      std::array source{0xD9_b, 0xBE_b, 0xED_b, 0xF6_b};
+      cbor::read_buffer buf{span_t{source}};
+
+      cbor::tagged_t v;
+      REQUIRE(cbor::decode(buf, v) == cbor::error::unexpected_type);
+   }
+}
@@ -30,6 +30,17 @@ TEST_CASE("Array - basic encoding", "[encoding, array]") {
    check_encoding(std::span{a3}, expected);
 }
 
+TEST_CASE("Array - byte arrays are encoded as byte strings", "[encoding, array]") {
+   // h'0102'
+   const std::array<std::byte, 2> a1{0x01_b, 0x02_b};
+   check_encoding(a1, {0x42, 0x01, 0x02});
+   check_encoding(std::span{a1}, {0x42, 0x01, 0x02});
+
+   // h''
+   const std::array<std::byte, 0> a2{};
+   check_encoding(a2, {0x40});
+}
+
 TEST_CASE("Array - encoding rollback on failure", "[encoding, array, rollback]") {
    // [1, 2, 3] -> {0x83, 0x01, 0x02, 0x03}
    const std::array<std::uint8_t, 3> a2{1, 2, 3};
@@ -0,0 +1,84 @@
+/**
+ * @file   bit_vector.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <test/encoding.h>
+
+#include <bitset>
+#include <vector>
+
+using namespace test;
+
+namespace {
+
+void check_bits(const std::vector<bool> &value, std::initializer_list<std::uint8_t> expected) {
+   std::vector<std::byte> target{};
+   cbor::dynamic_buffer buf{target};
+
+   REQUIRE(!cbor::encode(buf, value));
+   compare_arrays(value.size(), target, expected);
+}
+
+} // namespace
+
+TEST_CASE("Bit vector - basic encoding", "[encoding, bit_vector]") {
+   // h'00'
+   check_bits({}, {0x41, 0x00});
+
+   // h'0505': 5 unused bits, 0b101
+   check_bits({true, false, true}, {0x42, 0x05, 0x05});
+
+   // h'07FF01': 7 unused bits
+   check_bits(std::vector<bool>(9, true), {0x43, 0x07, 0xFF, 0x01});
+
+   // h'06A502'
+   check_encoding(std::bitset<10>{0x2A5}, {0x43, 0x06, 0xA5, 0x02});
+
+   // h'00'
+   check_encoding(std::bitset<0>{}, {0x41, 0x00});
+
+   // h'00' followed by 0xFF, repeated 8 times
+   check_encoding(std::bitset<64>{~0ULL}, {0x49, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF});
+
+   std::bitset<100> large{};
+   large.set(0);
+   large.set(99);
+   check_encoding(large,
+                  {0x4E, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08});
+}
+
+TEST_CASE("Bit vector - encoding is chunked", "[encoding, bit_vector]") {
+   std::vector<bool> v(1000);
+   for (std::size_t i = 0; i < v.size(); i += 3) {
+      v[i] = true;
+   }
+
+   std::vector<std::byte> target{};
+   cbor::dynamic_buffer buf{target};
+   REQUIRE(!cbor::encode(buf, v));
+
+   // 2 bytes of head, 1 byte of unused bits count, 125 bytes of data
+   REQUIRE(target.size() == 128);
+   REQUIRE(target[0] == 0x58_b);
+   REQUIRE(target[1] == 0x7E_b);
+   REQUIRE(target[2] == 0x00_b);
+
+   for (std::size_t i = 0; i < v.size(); ++i) {
+      const auto packed = std::to_integer<std::uint8_t>(target[3 + i / 8]);
+      REQUIRE(((packed >> (i % 8)) & 1U) == (v[i] ? 1U : 0U));
+   }
+}
+
+TEST_CASE("Bit vector - encoding rollback on failure", "[encoding, bit_vector, rollback]") {
+   const std::vector<bool> v(1000, true);
+
+   std::vector<std::byte> target{};
+   cbor::dynamic_buffer buf{target, 100};
+
+   REQUIRE(cbor::encode(buf, v) == cbor::error::buffer_overflow);
+   REQUIRE(target.empty());
+}
@@ -0,0 +1,135 @@
+/**
+ * @file   columnar.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <test/encoding.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace test;
+
+namespace {
+
+struct sample {
+   std::uint32_t id;
+   std::string name;
+   double value;
+   std::optional<std::int16_t> rank;
+
+   CBOR_FIELDS(sample, id, name, value, rank)
+};
+
+struct sample_columns {
+   std::vector<std::uint32_t> id;
+   std::vector<std::string> name;
+   std::vector<double> value;
+   std::vector<std::optional<std::int16_t>> rank;
+
+   CBOR_FIELDS(sample_columns, id, name, value, rank)
+};
+
+struct row {
+   std::uint8_t a;
+   std::int64_t b;
+
+   CBOR_FIELDS(row, a, b)
+};
+
+// [[1, "a", 0.5, null], [2, "bc", -1.0, 7]] in columns
+const std::initializer_list<std::uint8_t> two_samples{
+   0x84,                                                  // 4 columns
+   0xD8, 0x46, 0x48, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, // 70(h'0100000002000000')
+   0x82, 0x61, 0x61, 0x62, 0x62, 0x63,                   // ["a", "bc"]
+   0xD8, 0x56, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, // 86(h'000000000000E03F...')
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xBF,       // ...000000000000F0BF)
+   0x82, 0xF6, 0x07,                                     // [null, 7]
+};
+
+} // namespace
+
+template <>
+struct cbor::is_columnar<sample> : std::true_type {};
+
+template <>
+struct cbor::is_columnar<row> : std::true_type {};
+
+TEST_CASE("Columnar - typed array tags", "[encoding, columnar]") {
+   STATIC_REQUIRE(cbor::detail::typed_array_tag_v<std::uint8_t> == 64);
+   STATIC_REQUIRE(cbor::detail::typed_array_tag_v<std::uint16_t> == 69);
+   STATIC_REQUIRE(cbor::detail::typed_array_tag_v<std::uint32_t> == 70);
+   STATIC_REQUIRE(cbor::detail::typed_array_tag_v<std::uint64_t> == 71);
+   STATIC_REQUIRE(cbor::detail::typed_array_tag_v<std::int8_t> == 72);
+   STATIC_REQUIRE(cbor::detail::typed_array_tag_v<std::int16_t> == 77);
+   STATIC_REQUIRE(cbor::detail::typed_array_tag_v<std::int32_t> == 78);
+   STATIC_REQUIRE(cbor::detail::typed_array_tag_v<std::int64_t> == 79);
+   STATIC_REQUIRE(cbor::detail::typed_array_tag_v<float> == 85);
+   STATIC_REQUIRE(cbor::detail::typed_array_tag_v<double> == 86);
+}
+
+TEST_CASE("Columnar - basic encoding", "[encoding, columnar]") {
+   const std::vector<sample> samples{{1, "a", 0.5, std::nullopt}, {2, "bc", -1.0, 7}};
+   check_encoding(samples, two_samples);
+
+   // [64(h''), 79(h'')]
+   check_encoding(std::vector<row>{}, {0x82, 0xD8, 0x40, 0x40, 0xD8, 0x4F, 0x40});
+
+   // [64(h'0102'), 79(h'FFFFFFFFFFFFFFFF0001000000000000')]
+   check_encoding(std::vector<row>{{1, -1}, {2, 256}},
+                  {0x82, 0xD8, 0x40, 0x42, 0x01, 0x02, 0xD8, 0x4F, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                   0xFF, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00});
+
+   // Fixed-size arrays are still encoded row by row: [[1, -1]]
+   check_encoding(std::array<row, 1>{row{1, -1}}, {0x81, 0x82, 0x01, 0x20});
+}
+
+TEST_CASE("Columnar - typed arrays larger than a chunk", "[encoding, columnar]") {
+   std::vector<row> rows(100);
+   for (std::size_t i = 0; i < rows.size(); ++i) {
+      rows[i] = {static_cast<std::uint8_t>(i), static_cast<std::int64_t>(i) - 50};
+   }
+
+   std::vector<std::byte> target{};
+   cbor::dynamic_buffer buf{target};
+   REQUIRE(!cbor::encode(buf, rows));
+
+   // Array head, 64(h'...'): tag, 1-byte length, 100 bytes, 79(h'...'): tag, 2-byte length, 800 bytes
+   REQUIRE(target.size() == 1 + (2 + 2 + 100) + (2 + 3 + 800));
+   REQUIRE(target[1 + 2 + 2 + 99] == std::byte{99});
+
+   // Last element: 49 in little endian
+   REQUIRE(target[target.size() - 8] == std::byte{49});
+}
+
+TEST_CASE("Columnar - struct of arrays", "[encoding, columnar]") {
+   const sample_columns columns{{1, 2}, {"a", "bc"}, {0.5, -1.0}, {std::nullopt, 7}};
+
+   std::vector<std::byte> target{};
+   cbor::dynamic_buffer buf{target};
+   REQUIRE(!cbor::encode_columns(buf, columns));
+   compare_arrays(0, target, two_samples);
+
+   // All the columns have to be of the same size
+   const sample_columns invalid{{1, 2}, {"a"}, {0.5, -1.0}, {std::nullopt, 7}};
+   target.clear();
+   REQUIRE(cbor::encode_columns(buf, invalid) == cbor::error::invalid_usage);
+   REQUIRE(target.empty());
+}
+
+TEST_CASE("Columnar - encoding rollback on failure", "[encoding, columnar, rollback]") {
+   const std::vector<sample> samples{{1, "a", 0.5, std::nullopt}, {2, "bc", -1.0, 7}};
+
+   for (std::size_t limit = 0; limit < two_samples.size(); ++limit) {
+      std::vector<std::byte> target{};
+      cbor::dynamic_buffer buf{target, limit};
+
+      INFO("Limit: " << limit);
+      REQUIRE(cbor::encode(buf, samples) == cbor::error::buffer_overflow);
+      REQUIRE(target.empty());
+   }
+}
@@ -0,0 +1,258 @@
+/**
+ * @file   constant.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ *
+ * Ensure that compile-time encoding produces exactly the same bytes as the runtime encoder.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cbor/constant.h>
+
+#include <test/encoding.h>
+
+#include <bit>
+#include <limits>
+
+using namespace test;
+
+namespace {
+
+enum class command : std::uint8_t {
+   heartbeat = 1,
+   handshake = 2,
+};
+
+struct heartbeat {
+   command cmd;
+   std::uint32_t sequence;
+   std::string_view source;
+   std::optional<double> load;
+   std::array<std::int16_t, 3> flags;
+};
+
+[[maybe_unused]] consteval void enable_cbor_encoding(heartbeat);
+
+struct handshake {
+   std::uint64_t version;
+   bool compressed;
+};
+
+struct error_response {
+   std::int32_t code;
+   const char *message;
+};
+
+} // namespace
+
+template <>
+consteval std::size_t cbor::get_member_count<heartbeat>() {
+   return 5;
+}
+
+template <>
+constexpr const auto &cbor::get_member<0>(const heartbeat &v) {
+   return v.cmd;
+}
+
+template <>
+constexpr const auto &cbor::get_member<1>(const heartbeat &v) {
+   return v.sequence;
+}
+
+template <>
+constexpr const auto &cbor::get_member<2>(const heartbeat &v) {
+   return v.source;
+}
+
+template <>
+constexpr const auto &cbor::get_member<3>(const heartbeat &v) {
+   return v.load;
+}
+
+template <>
+constexpr const auto &cbor::get_member<4>(const heartbeat &v) {
+   return v.flags;
+}
+
+namespace cbor {
+
+template <>
+struct type_id<handshake> : std::integral_constant<std::uint64_t, 0x10> {};
+
+template <>
+struct type_id<error_response> : std::integral_constant<std::uint64_t, 0x11> {};
+
+template <>
+struct is_tagged_variant<std::variant<error_response, handshake>> : std::true_type {};
+
+template <>
+consteval std::size_t get_member_count<handshake>() {
+   return 2;
+}
+
+template <>
+constexpr const auto &get_member<0>(const handshake &v) {
+   return v.version;
+}
+
+template <>
+constexpr const auto &get_member<1>(const handshake &v) {
+   return v.compressed;
+}
+
+template <>
+consteval std::size_t get_member_count<error_response>() {
+   return 2;
+}
+
+template <>
+constexpr const auto &get_member<0>(const error_response &v) {
+   return v.code;
+}
+
+template <>
+constexpr const auto &get_member<1>(const error_response &v) {
+   return v.message;
+}
+
+} // namespace cbor
+
+namespace {
+
+template <typename T, std::size_t N>
+void check_constant(const std::array<std::byte, N> &constant, const T &value) {
+   std::vector<std::byte> expected{};
+   cbor::dynamic_buffer buf{expected};
+   REQUIRE(!encode(buf, value));
+
+   const std::vector<std::byte> actual{constant.begin(), constant.end()};
+   INFO("Comparing '" << hex(actual) << "' with '" << hex(expected) << "'");
+   REQUIRE(actual == expected);
+}
+
+#define CHECK_CONSTANT(...)                                                                                            \
+   do {                                                                                                                \
+      static constexpr auto constant = cbor::encode_constant([] { return __VA_ARGS__; });                              \
+      check_constant(constant, __VA_ARGS__);                                                                           \
+   } while (false)
+
+//! Encode the value with the constexpr encoder, but at runtime
+template <typename T>
+std::vector<std::byte> encode_with_constant_writer(const T &value) {
+   cbor::detail::constant_writer counter{};
+   encode_constant(counter, value);
+
+   std::vector<std::byte> result(counter.size());
+   cbor::detail::constant_writer w{result.data()};
+   encode_constant(w, value);
+   return result;
+}
+
+} // namespace
+
+TEST_CASE("Constant - simple types", "[encoding, constant]") {
+   CHECK_CONSTANT(0U);
+   CHECK_CONSTANT(23U);
+   CHECK_CONSTANT(24U);
+   CHECK_CONSTANT(std::uint16_t{0x1234});
+   CHECK_CONSTANT(std::uint32_t{0x12345678});
+   CHECK_CONSTANT(std::uint64_t{0x1234567890ABCDEF});
+   CHECK_CONSTANT(std::numeric_limits<std::uint64_t>::max());
+
+   CHECK_CONSTANT(-1);
+   CHECK_CONSTANT(-500);
+   CHECK_CONSTANT(std::numeric_limits<std::int64_t>::min());
+   CHECK_CONSTANT(std::numeric_limits<std::int8_t>::min());
+
+   CHECK_CONSTANT(command::handshake);
+
+   CHECK_CONSTANT(true);
+   CHECK_CONSTANT(false);
+   CHECK_CONSTANT(nullptr);
+   CHECK_CONSTANT(std::optional<int>{});
+   CHECK_CONSTANT(std::optional<int>{42});
+}
+
+TEST_CASE("Constant - floats", "[encoding, constant]") {
+   CHECK_CONSTANT(0.0f);
+   CHECK_CONSTANT(-0.0);
+   CHECK_CONSTANT(1.0f);
+   CHECK_CONSTANT(1.1f);
+   CHECK_CONSTANT(1.1);
+   CHECK_CONSTANT(65504.0);
+   CHECK_CONSTANT(100000.0f);
+   CHECK_CONSTANT(5.960464477539063e-8);
+   CHECK_CONSTANT(1.0e+300);
+   CHECK_CONSTANT(std::numeric_limits<float>::infinity());
+   CHECK_CONSTANT(-std::numeric_limits<double>::infinity());
+   CHECK_CONSTANT(std::numeric_limits<double>::quiet_NaN());
+
+   SECTION("Half-float detection matches the runtime encoder") {
+      // Walk over all exponents, with different mantissa patterns
+      for (std::uint32_t exponent = 0; exponent < 0xFF; ++exponent) {
+         for (std::uint32_t mantissa : {0x000000U, 0x000001U, 0x001000U, 0x002000U, 0x3FE000U, 0x400000U, 0x7FFFFFU}) {
+            for (std::uint32_t sign : {0U, 1U}) {
+               const auto v = std::bit_cast<float>((sign << 31U) | (exponent << 23U) | mantissa);
+
+               std::vector<std::byte> expected{};
+               cbor::dynamic_buffer buf{expected};
+               REQUIRE(!cbor::encode(buf, v));
+
+               INFO("Value: " << v);
+               REQUIRE(encode_with_constant_writer(v) == expected);
+            }
+         }
+      }
+   }
+}
+
+TEST_CASE("Constant - strings and arrays", "[encoding, constant]") {
+   CHECK_CONSTANT("");
+   CHECK_CONSTANT("hello");
+   CHECK_CONSTANT(std::string_view{"a string that is definitely longer than twenty three characters"});
+   CHECK_CONSTANT(std::array<int, 3>{1, -2, 3});
+   CHECK_CONSTANT(std::array<std::byte, 2>{std::byte{0x01}, std::byte{0x02}});
+   CHECK_CONSTANT(std::array<std::optional<bool>, 2>{true, std::nullopt});
+
+   SECTION("Byte strings") {
+      static constexpr std::array<std::byte, 3> bytes{std::byte{0xDE}, std::byte{0xAD}, std::byte{0x00}};
+      CHECK_CONSTANT(cbor::buffer::const_span_t{bytes});
+   }
+
+   SECTION("Transient allocations") {
+      static constexpr auto constant = cbor::encode_constant([] { return std::vector<int>{1, 2, 3, 1000}; });
+      check_constant(constant, std::vector<int>{1, 2, 3, 1000});
+   }
+
+   SECTION("Bit vectors") {
+      CHECK_CONSTANT(std::bitset<10>{0x2A5});
+      CHECK_CONSTANT(std::bitset<0>{});
+
+      static constexpr auto constant = cbor::encode_constant([] { return std::vector<bool>{true, false, true}; });
+      check_constant(constant, std::vector<bool>{true, false, true});
+   }
+}
+
+TEST_CASE("Constant - structs and variants", "[encoding, constant]") {
+   CHECK_CONSTANT(heartbeat{command::heartbeat, 1000, "node-1", 0.5, {1, -1, 300}});
+   CHECK_CONSTANT(heartbeat{command::heartbeat, 0, "", std::nullopt, {}});
+   CHECK_CONSTANT(handshake{2, true});
+   CHECK_CONSTANT(error_response{-404, "not found"});
+
+   using message_t = std::variant<handshake, error_response>;
+   CHECK_CONSTANT(message_t{handshake{1, false}});
+   CHECK_CONSTANT(message_t{error_response{500, "internal error"}});
+
+   using tagged_t = std::variant<error_response, handshake>;
+   CHECK_CONSTANT(tagged_t{handshake{1, false}});
+   CHECK_CONSTANT(tagged_t{error_response{500, "internal error"}});
+
+   // Messages are usable as a compile-time constant
+   static constexpr auto bytes = cbor::encode_constant([] { return handshake{1, false}; });
+   static_assert(bytes.size() == 3);
+   static_assert(bytes[0] == std::byte{0x82});
+   static_assert(bytes[1] == std::byte{0x01});
+   static_assert(bytes[2] == std::byte{0xF4});
+}
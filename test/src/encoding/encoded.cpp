@@ -0,0 +1,190 @@
+/**
+ * @file   encoded.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ *
+ * Ensure that pre-encoded values are spliced verbatim, and can be captured while decoding.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cbor/encoded.h>
+
+#include <test/encoding.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace test;
+
+namespace {
+
+struct contact {
+   std::string name;
+   std::vector<std::string> phones;
+};
+
+[[maybe_unused]] consteval void enable_cbor_encoding(contact);
+
+struct response {
+   std::int64_t request_id;
+   cbor::encoded<std::map<std::string, contact>> contacts;
+};
+
+[[maybe_unused]] consteval void enable_cbor_encoding(response);
+
+} // namespace
+
+template <>
+consteval std::size_t cbor::get_member_count<contact>() {
+   return 2;
+}
+
+template <>
+constexpr const auto &cbor::get_member<0>(const contact &v) {
+   return v.name;
+}
+
+template <>
+constexpr const auto &cbor::get_member<1>(const contact &v) {
+   return v.phones;
+}
+
+template <>
+constexpr auto &cbor::get_member_non_const<0>(contact &v) {
+   return v.name;
+}
+
+template <>
+constexpr auto &cbor::get_member_non_const<1>(contact &v) {
+   return v.phones;
+}
+
+template <>
+consteval std::size_t cbor::get_member_count<response>() {
+   return 2;
+}
+
+template <>
+constexpr const auto &cbor::get_member<0>(const response &v) {
+   return v.request_id;
+}
+
+template <>
+constexpr const auto &cbor::get_member<1>(const response &v) {
+   return v.contacts;
+}
+
+template <>
+constexpr auto &cbor::get_member_non_const<0>(response &v) {
+   return v.request_id;
+}
+
+template <>
+constexpr auto &cbor::get_member_non_const<1>(response &v) {
+   return v.contacts;
+}
+
+namespace {
+
+const std::map<std::string, contact> contacts{
+   {"alice", {"Alice", {"+1 555", "+1 556"}}},
+   {"bob", {"Bob", {}}},
+};
+
+} // namespace
+
+TEST_CASE("Encoded - splicing", "[encoding, encoded]") {
+   cbor::encoded<std::map<std::string, contact>> encoded_contacts{};
+   REQUIRE(encoded_contacts.empty());
+
+   std::vector<std::byte> target{};
+   cbor::dynamic_buffer buf{target};
+   REQUIRE(cbor::encode(buf, encoded_contacts) == cbor::error::invalid_usage);
+
+   REQUIRE(!encoded_contacts.assign(contacts));
+   REQUIRE(!encoded_contacts.empty());
+   REQUIRE(std::ranges::equal(encoded_contacts.bytes(), encode_to_vector(contacts)));
+
+   SECTION("Spliced into an enclosing message") {
+      const auto actual = encode_to_vector(response{42, encoded_contacts});
+
+      // Same as encoding the original value directly
+      std::vector<std::byte> reference{};
+      cbor::dynamic_buffer reference_buf{reference};
+      REQUIRE(!cbor::encode_argument(reference_buf, cbor::major_type::array, 2U));
+      REQUIRE(!cbor::encode(reference_buf, std::int64_t{42}));
+      REQUIRE(!cbor::encode(reference_buf, contacts));
+      REQUIRE(actual == reference);
+   }
+
+   SECTION("Copies share the encoding") {
+      const auto copy = encoded_contacts;
+      REQUIRE(copy.bytes().data() == encoded_contacts.bytes().data());
+
+      // Re-assigning doesn't affect the copies
+      REQUIRE(!encoded_contacts.assign(std::map<std::string, contact>{}));
+      REQUIRE(copy.bytes().size() != encoded_contacts.bytes().size());
+      REQUIRE(std::ranges::equal(copy.bytes(), encode_to_vector(contacts)));
+   }
+}
+
+TEST_CASE("Encoded - validation", "[encoding, encoded]") {
+   const auto bytes = encode_to_vector(contacts);
+
+   cbor::encoded<std::map<std::string, contact>> encoded_contacts{};
+   REQUIRE(!encoded_contacts.assign_bytes(cbor::buffer::const_span_t{bytes}));
+   REQUIRE(std::ranges::equal(encoded_contacts.bytes(), bytes));
+
+   // Trailing bytes
+   auto trailing = bytes;
+   trailing.push_back(std::byte{0x00});
+   REQUIRE(encoded_contacts.assign_bytes(cbor::buffer::const_span_t{trailing}) == cbor::error::decoding_error);
+
+   // Truncated
+   REQUIRE(encoded_contacts.assign_bytes(cbor::buffer::const_span_t{bytes}.first(bytes.size() - 1)));
+
+   // Wrong type
+   const auto number = encode_to_vector(10);
+   REQUIRE(encoded_contacts.assign_bytes(cbor::buffer::const_span_t{number}) == cbor::error::unexpected_type);
+
+   // Failed assignments keep the previous value
+   REQUIRE(std::ranges::equal(encoded_contacts.bytes(), bytes));
+}
+
+TEST_CASE("Encoded - decoding", "[encoding, encoded]") {
+   cbor::encoded<std::map<std::string, contact>> encoded_contacts{};
+   REQUIRE(!encoded_contacts.assign(contacts));
+
+   const auto message = encode_to_vector(response{7, encoded_contacts});
+
+   cbor::read_buffer buf{message};
+   response decoded{};
+   REQUIRE(!cbor::decode(buf, decoded));
+   REQUIRE(buf.read_position() == message.size());
+
+   REQUIRE(decoded.request_id == 7);
+   REQUIRE(std::ranges::equal(decoded.contacts.bytes(), encoded_contacts.bytes()));
+
+   std::map<std::string, contact> value{};
+   REQUIRE(!decoded.contacts.decode_value(value));
+   REQUIRE(value.size() == 2);
+   REQUIRE(value["alice"].phones == std::vector<std::string>{"+1 555", "+1 556"});
+
+   SECTION("Malformed items are not captured") {
+      auto truncated = message;
+      truncated.pop_back();
+
+      cbor::read_buffer truncated_buf{truncated};
+      response partial{};
+      REQUIRE(cbor::decode(truncated_buf, partial));
+   }
+
+   SECTION("Empty values can't be decoded") {
+      cbor::encoded<int> empty{};
+      int v{};
+      REQUIRE(empty.decode_value(v) == cbor::error::invalid_usage);
+   }
+}
@@ -0,0 +1,129 @@
+/**
+ * @file   encoded_array.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ *
+ * Ensure that encoded arrays stay decodable as regular arrays while being appended to.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cbor/encoded_array.h>
+
+#include <test/encoding.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace test;
+
+namespace {
+
+template <typename T>
+std::vector<T> decode_vector(cbor::buffer::const_span_t bytes) {
+   cbor::read_buffer buf{bytes};
+
+   std::vector<T> result{};
+   REQUIRE(!cbor::decode(buf, result));
+   REQUIRE(buf.read_position() == bytes.size());
+   return result;
+}
+
+} // namespace
+
+TEST_CASE("Encoded array - appending", "[encoding, encoded_array]") {
+   cbor::encoded_array<std::string> array{};
+   REQUIRE(array.empty());
+   REQUIRE(array.elements().empty());
+   REQUIRE(std::vector<std::byte>{array.bytes().begin(), array.bytes().end()}
+           == as_bytes(std::vector<std::uint8_t>{0x9A, 0x00, 0x00, 0x00, 0x00}));
+   REQUIRE(decode_vector<std::string>(array.bytes()).empty());
+
+   std::vector<std::string> expected{};
+   for (std::size_t i = 0; i < 300; ++i) {
+      expected.emplace_back(i % 40, static_cast<char>('a' + i % 26));
+      REQUIRE(!array.push_back(expected.back()));
+
+      REQUIRE(array.size() == expected.size());
+      REQUIRE(decode_vector<std::string>(array.bytes()) == expected);
+   }
+
+   // The elements are encoded the same way as in a regular array
+   const auto regular = encode_to_vector(expected);
+   const auto regular_head_size = 3; // 0x99 0x01 0x2C
+   REQUIRE(std::ranges::equal(array.elements(), cbor::buffer::const_span_t{regular}.subspan(regular_head_size)));
+
+   SECTION("Spliced into other messages") {
+      std::vector<std::byte> target{};
+      cbor::dynamic_buffer buf{target};
+      REQUIRE(!cbor::encode(buf, array));
+      REQUIRE(std::ranges::equal(target, array.bytes()));
+   }
+
+   SECTION("Clearing") {
+      array.clear();
+      REQUIRE(array.empty());
+      REQUIRE(decode_vector<std::string>(array.bytes()).empty());
+   }
+}
+
+TEST_CASE("Encoded array - count limits", "[encoding, encoded_array]") {
+   cbor::encoded_array<int, std::uint8_t> array{};
+   for (int i = 0; i < 255; ++i) {
+      REQUIRE(!array.push_back(i));
+   }
+
+   const std::vector<std::byte> before{array.bytes().begin(), array.bytes().end()};
+   REQUIRE(array.push_back(255) == cbor::error::value_not_representable);
+   REQUIRE(array.push_back_encoded(encode_to_vector(255)) == cbor::error::value_not_representable);
+   REQUIRE(std::ranges::equal(array.bytes(), before));
+
+   const auto decoded = decode_vector<int>(array.bytes());
+   REQUIRE(decoded.size() == 255);
+   REQUIRE(decoded.back() == 254);
+}
+
+TEST_CASE("Encoded array - pre-encoded elements", "[encoding, encoded_array]") {
+   cbor::encoded_array<int> array{};
+   REQUIRE(!array.push_back_encoded(encode_to_vector(-10)));
+   REQUIRE(!array.push_back(20));
+
+   // Malformed or more than one item
+   REQUIRE(array.push_back_encoded(as_bytes(std::vector<std::uint8_t>{0x19, 0x01})));
+   REQUIRE(array.push_back_encoded(as_bytes(std::vector<std::uint8_t>{0x01, 0x02})) == cbor::error::decoding_error);
+
+   REQUIRE(decode_vector<int>(array.bytes()) == std::vector<int>{-10, 20});
+}
+
+TEST_CASE("Encoded array - decoding", "[encoding, encoded_array]") {
+   const std::vector<int> values{1, 2, 3, 1000, -5};
+   const auto bytes = encode_to_vector(values);
+
+   cbor::read_buffer buf{bytes};
+   cbor::encoded_array<int> array{};
+   REQUIRE(!cbor::decode(buf, array));
+   REQUIRE(buf.read_position() == bytes.size());
+   REQUIRE(array.size() == values.size());
+
+   // Re-encoded with a fixed-width head, and still appendable
+   REQUIRE(array.bytes().size() == bytes.size() + 4);
+   REQUIRE(!array.push_back(6));
+   REQUIRE(decode_vector<int>(array.bytes()) == std::vector<int>{1, 2, 3, 1000, -5, 6});
+
+   SECTION("Invalid input") {
+      const auto number = encode_to_vector(10);
+      cbor::read_buffer number_buf{number};
+      REQUIRE(cbor::decode(number_buf, array) == cbor::error::unexpected_type);
+      REQUIRE(number_buf.read_position() == 0);
+
+      auto truncated = bytes;
+      truncated.pop_back();
+      cbor::read_buffer truncated_buf{truncated};
+      REQUIRE(cbor::decode(truncated_buf, array));
+      REQUIRE(truncated_buf.read_position() == 0);
+
+      // Failed decoding leaves the array untouched
+      REQUIRE(array.size() == values.size() + 1);
+   }
+}
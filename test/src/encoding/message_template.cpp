@@ -0,0 +1,205 @@
+/**
+ * @file   message_template.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ *
+ * Ensure that message templates produce decodable messages, and that patching fields is equivalent to encoding them.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cbor/decoding.h>
+#include <cbor/message_template.h>
+
+#include <test/encoding.h>
+
+#include <limits>
+#include <tuple>
+
+using namespace test;
+
+namespace {
+
+enum class status : std::int8_t {
+   ok = 0,
+   not_found = -4,
+   internal = 50,
+};
+
+struct response {
+   std::uint32_t id;
+   std::string body;
+   status code;
+   std::int64_t counter;
+   bool cached;
+};
+
+bool operator==(const response &lhs, const response &rhs) {
+   return std::tie(lhs.id, lhs.body, lhs.code, lhs.counter, lhs.cached)
+      == std::tie(rhs.id, rhs.body, rhs.code, rhs.counter, rhs.cached);
+}
+
+[[maybe_unused]] consteval void enable_cbor_encoding(response);
+
+} // namespace
+
+template <>
+consteval std::size_t cbor::get_member_count<response>() {
+   return 5;
+}
+
+template <>
+constexpr const auto &cbor::get_member<0>(const response &v) {
+   return v.id;
+}
+
+template <>
+constexpr const auto &cbor::get_member<1>(const response &v) {
+   return v.body;
+}
+
+template <>
+constexpr const auto &cbor::get_member<2>(const response &v) {
+   return v.code;
+}
+
+template <>
+constexpr const auto &cbor::get_member<3>(const response &v) {
+   return v.counter;
+}
+
+template <>
+constexpr const auto &cbor::get_member<4>(const response &v) {
+   return v.cached;
+}
+
+template <>
+constexpr auto &cbor::get_member_non_const<0>(response &v) {
+   return v.id;
+}
+
+template <>
+constexpr auto &cbor::get_member_non_const<1>(response &v) {
+   return v.body;
+}
+
+template <>
+constexpr auto &cbor::get_member_non_const<2>(response &v) {
+   return v.code;
+}
+
+template <>
+constexpr auto &cbor::get_member_non_const<3>(response &v) {
+   return v.counter;
+}
+
+template <>
+constexpr auto &cbor::get_member_non_const<4>(response &v) {
+   return v.cached;
+}
+
+namespace {
+
+response decode_response(cbor::buffer::const_span_t bytes) {
+   cbor::read_buffer buf{bytes};
+
+   response result{};
+   REQUIRE(!cbor::decode(buf, result));
+   REQUIRE(buf.read_position() == bytes.size());
+   return result;
+}
+
+template <typename T>
+void check_fixed_field(T v) {
+   std::vector<std::byte> expected{};
+   cbor::dynamic_buffer buf{expected};
+   REQUIRE(!cbor::detail::encode_fixed_field(buf, v));
+
+   const auto field = cbor::detail::encode_fixed_field(v);
+   const std::vector<std::byte> actual{field.begin(), field.end()};
+
+   INFO("Comparing '" << hex(actual) << "' with '" << hex(expected) << "'");
+   REQUIRE(actual == expected);
+}
+
+} // namespace
+
+TEST_CASE("Message template - fixed-width fields", "[encoding, message_template]") {
+   check_fixed_field(std::uint8_t{0});
+   check_fixed_field(std::uint8_t{0xFF});
+   check_fixed_field(std::uint16_t{1});
+   check_fixed_field(std::uint32_t{0x12345678});
+   check_fixed_field(std::uint64_t{5});
+   check_fixed_field(std::numeric_limits<std::uint64_t>::max());
+   check_fixed_field(std::int8_t{-1});
+   check_fixed_field(std::numeric_limits<std::int16_t>::min());
+   check_fixed_field(std::int32_t{-500});
+   check_fixed_field(std::numeric_limits<std::int64_t>::min());
+   check_fixed_field(status::not_found);
+   check_fixed_field(true);
+   check_fixed_field(false);
+
+   // Small values still occupy the whole width
+   using namespace cbor::detail;
+   REQUIRE(encode_fixed_field(std::uint32_t{1}) == std::array{0x1A_b, 0x00_b, 0x00_b, 0x00_b, 0x01_b});
+   REQUIRE(encode_fixed_field(std::int16_t{-1}) == std::array{0x39_b, 0x00_b, 0x00_b});
+}
+
+TEST_CASE("Message template - patching", "[encoding, message_template]") {
+   const response prototype{0, "a static response body", status::ok, 0, false};
+
+   cbor::message_template<response, 0, 2, 3, 4> tmpl{};
+   REQUIRE(tmpl.set<0>(1) == cbor::error::invalid_usage);
+
+   REQUIRE(!tmpl.assign(prototype));
+   REQUIRE(decode_response(tmpl.bytes()) == prototype);
+
+   // Array head, followed by a fixed-width u32
+   REQUIRE(tmpl.offset_of<0>() == 1);
+   REQUIRE(tmpl.bytes()[1] == std::byte{0x1A});
+
+   SECTION("Updating the template") {
+      const std::size_t original_size = tmpl.bytes().size();
+
+      for (std::int64_t i = -1000; i < 1000; i += 7) {
+         const response expected{static_cast<std::uint32_t>(i * 1000003),
+                                 prototype.body,
+                                 (i % 2) ? status::not_found : status::internal,
+                                 i * std::numeric_limits<std::int32_t>::max(),
+                                 i % 3 == 0};
+
+         REQUIRE(!tmpl.set<0>(expected.id));
+         REQUIRE(!tmpl.set<2>(expected.code));
+         REQUIRE(!tmpl.set<3>(expected.counter));
+         REQUIRE(!tmpl.set<4>(expected.cached));
+
+         REQUIRE(tmpl.bytes().size() == original_size);
+         REQUIRE(decode_response(tmpl.bytes()) == expected);
+      }
+   }
+
+   SECTION("Patching copies") {
+      std::vector<std::byte> target{};
+      cbor::dynamic_buffer buf{target};
+      REQUIRE(!tmpl.write(buf));
+      REQUIRE(!tmpl.write(buf));
+
+      const auto size = tmpl.bytes().size();
+      auto first = cbor::buffer::span_t{target}.first(size);
+      auto second = cbor::buffer::span_t{target}.subspan(size);
+
+      REQUIRE(!tmpl.patch<0>(first, 1));
+      REQUIRE(!tmpl.patch<0>(second, 2));
+      REQUIRE(!tmpl.patch<4>(second, true));
+
+      REQUIRE(decode_response(first).id == 1);
+      REQUIRE(decode_response(second).id == 2);
+      REQUIRE(decode_response(second).cached);
+
+      // The template itself is untouched
+      REQUIRE(decode_response(tmpl.bytes()) == prototype);
+
+      // Too short for the field
+      REQUIRE(tmpl.patch<4>(first.first(size - 1), true) == cbor::error::invalid_usage);
+   }
+}
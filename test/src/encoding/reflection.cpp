@@ -6,6 +6,7 @@
  * Ensure that
  * - it is possible to provide custom reflection functions when Boost PFR is disabled.
  * - Boost PFR works for bare structs.
+ * - registered fields work for classes with private and inherited members.
  */
 
 #include <catch2/catch_test_macros.hpp>
@@ -14,6 +15,9 @@
 
 #include <test/encoding.h>
 
+#include <optional>
+#include <string>
+
 using namespace test;
 
 namespace {
@@ -40,6 +44,29 @@ struct custom_reflection {
 };
 
 [[maybe_unused]] consteval void enable_cbor_encoding(custom_reflection);
+
+struct entity {
+   std::uint32_t id;
+};
+
+class registered_fields : public entity {
+public:
+   registered_fields(std::uint32_t id, std::string name, std::optional<int> rank)
+      : entity{id}
+      , name_{std::move(name)}
+      , rank_{rank} {}
+
+private:
+   CBOR_FIELDS(registered_fields, id, name_, rank_)
+
+   std::string name_;
+   std::optional<int> rank_;
+};
+
+// Registration is not inherited
+class derived_fields : public registered_fields {
+   using registered_fields::registered_fields;
+};
 } // namespace
 
 #if CBOR_WITH(BOOST_PFR)
@@ -86,6 +113,18 @@ TEST_CASE("Struct - encoding with custom reflection", "[encoding, struct]") {
    check_encoding(custom_reflection{10, 20, {1, 2}, {3, 4}}, {0x84, 0x0A, 0x14, 0x82, 0x01, 0x02, 0x82, 0x03, 0x04});
 }
 
+TEST_CASE("Struct - encoding with registered fields", "[encoding, struct]") {
+   static_assert(cbor::WithFieldTable<registered_fields>);
+   static_assert(!cbor::WithFieldTable<derived_fields>);
+   static_assert(cbor::get_member_count<registered_fields>() == 3);
+
+   // [7, "ab", 3]
+   check_encoding(registered_fields{7, "ab", 3}, {0x83, 0x07, 0x62, 0x61, 0x62, 0x03});
+
+   // [7, "", null]
+   check_encoding(registered_fields{7, "", std::nullopt}, {0x83, 0x07, 0x60, 0xF6});
+}
+
 TEST_CASE("Struct - encoding with custom reflection and wrapped in optional", "[encoding, struct, optional]") {
    check_encoding(std::optional<custom_reflection>{{10, 20, {1, 2}, {3, 4}}},
                   {0x84, 0x0A, 0x14, 0x82, 0x01, 0x02, 0x82, 0x03, 0x04});
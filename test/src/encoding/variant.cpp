@@ -25,6 +25,8 @@ struct variant_b {
    bool b;
 };
 
+struct variant_c {};
+
 namespace cbor {
 
 template <>
@@ -84,6 +86,19 @@ struct type_id<variant_b> : std::integral_constant<std::uint64_t, 0xDEAF> {};
    return res;
 }
 
+template <>
+struct type_id<variant_c> : std::integral_constant<std::int64_t, -500> {};
+
+[[nodiscard]] std::error_code encode(buffer &buf, const variant_c &) {
+   return encode(buf, nullptr);
+}
+
+//! Same alternatives, but encoded as tags
+using tagged_t = std::variant<variant_b, variant_a>;
+
+template <>
+struct is_tagged_variant<tagged_t> : std::true_type {};
+
 } // namespace cbor
 
 static_assert(cbor::type_id_v<variant_a> == 0xBEEF);
@@ -133,6 +148,51 @@ TEST_CASE("Variant - basic encoding", "[encoding, variant]") {
                   });
 }
 
+TEST_CASE("Variant - negative type IDs", "[encoding, variant]") {
+   using value_t = std::variant<variant_a, variant_c>;
+
+   const value_t v = variant_c{};
+   check_encoding(v,
+                  {
+                     0x82,             // Array of two elements
+                     0x39, 0x01, 0xF3, // Type ID = -500
+                     0xF6,             // null
+                  });
+}
+
+TEST_CASE("Variant - tagged encoding", "[encoding, variant]") {
+   cbor::tagged_t first = variant_a{.a = 1, .b = 0.0, .c = "a"};
+   const cbor::tagged_t second = variant_b{.a = std::nullopt, .b = true};
+
+   // type_id([a, b, c])
+   check_encoding(first,
+                  {
+                     0xD9, 0xBE, 0xEF, // Tag = Type ID
+                     0x83,             // Array of three elements
+                     0x01,             // a = 1
+                     0xF9, 0x00, 0x00, // b = 0.0
+                     0x61, 0x61        // c = "a"
+                  });
+
+   // type_id([a, b])
+   check_encoding(second,
+                  {
+                     0xD9, 0xDE, 0xAF, // Tag = Type ID
+                     0x82,             // Array of two elements
+                     0xF6,             // a = nullopt
+                     0xF5,             // b = true
+                  });
+
+   SECTION("Rollback on failure") {
+      std::vector<std::byte> target;
+      cbor::dynamic_buffer buf{target, 4};
+
+      std::error_code ec = cbor::encode(buf, second);
+      REQUIRE(ec == cbor::error::buffer_overflow);
+      REQUIRE(buf.size() == 0);
+   }
+}
+
 TEST_CASE("Variant - encoding rollback on failure", "[encoding, variant, rollback]") {
    using value_t = std::variant<variant_a, variant_b>;
 
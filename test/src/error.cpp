@@ -48,6 +48,7 @@ TEST_CASE("Error - codes are named", "[error]") {
    std::array codes = {
       error::success,         error::encoding_error,          error::decoding_error, error::buffer_underflow,
       error::buffer_overflow, error::value_not_representable, error::invalid_usage,  error::unexpected_type, error::ill_formed,
+      error::not_found,
    };
 
    for (auto code : codes) {
@@ -0,0 +1,177 @@
+/**
+ * @file   field_update.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ *
+ * Ensure that nested data items are found by their path, and can be replaced without re-encoding the whole message.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cbor/decoding.h>
+#include <cbor/field_update.h>
+
+#include <test/encoding.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace test;
+
+namespace {
+
+//! {"hops": [1, 2, 3], "origin": "gateway", "ttl": 300}
+std::vector<std::byte> make_message() {
+   std::vector<std::byte> result{};
+   cbor::dynamic_buffer buf{result};
+
+   REQUIRE(!cbor::encode_argument(buf, cbor::major_type::dictionary, 3U));
+   REQUIRE(!cbor::encode(buf, "hops"));
+   REQUIRE(!cbor::encode(buf, std::vector<std::int64_t>{1, 2, 3}));
+   REQUIRE(!cbor::encode(buf, "origin"));
+   REQUIRE(!cbor::encode(buf, "gateway"));
+   REQUIRE(!cbor::encode(buf, "ttl"));
+   REQUIRE(!cbor::encode(buf, std::int64_t{300}));
+   return result;
+}
+
+template <typename T>
+T decode_field(cbor::buffer::const_span_t data, std::initializer_list<cbor::path_element> path) {
+   cbor::field_location location{};
+   REQUIRE(!cbor::locate(data, cbor::path_t{path.begin(), path.size()}, location));
+
+   cbor::read_buffer buf{data.subspan(location.offset, location.size)};
+   T result{};
+   REQUIRE(!cbor::decode(buf, result));
+   REQUIRE(static_cast<std::size_t>(buf.read_position()) == location.size);
+   return result;
+}
+
+} // namespace
+
+TEST_CASE("Field update - locating", "[field_update]") {
+   const auto message = make_message();
+   const cbor::buffer::const_span_t data{message};
+
+   cbor::field_location location{};
+   REQUIRE(!cbor::locate(data, {}, location));
+   REQUIRE(location.offset == 0);
+   REQUIRE(location.size == message.size());
+
+   const cbor::path_element ttl[] = {"ttl"};
+   REQUIRE(!cbor::locate(data, ttl, location));
+   REQUIRE(location.size == 3); // 0x19 0x01 0x2C
+   REQUIRE(location.offset + location.size == message.size());
+
+   REQUIRE(decode_field<std::int64_t>(data, {"ttl"}) == 300);
+   REQUIRE(decode_field<std::string>(data, {"origin"}) == "gateway");
+   REQUIRE(decode_field<std::int64_t>(data, {"hops", 2}) == 3);
+
+   SECTION("Invalid paths") {
+      const cbor::path_element missing_key[] = {"hop"};
+      REQUIRE(cbor::locate(data, missing_key, location) == cbor::error::not_found);
+
+      const cbor::path_element missing_index[] = {"hops", 3};
+      REQUIRE(cbor::locate(data, missing_index, location) == cbor::error::not_found);
+
+      const cbor::path_element index_into_map[] = {0};
+      REQUIRE(cbor::locate(data, index_into_map, location) == cbor::error::unexpected_type);
+
+      const cbor::path_element key_into_array[] = {"hops", "first"};
+      REQUIRE(cbor::locate(data, key_into_array, location) == cbor::error::unexpected_type);
+
+      const cbor::path_element int_key[] = {cbor::path_element::int_key(0)};
+      REQUIRE(cbor::locate(data, int_key, location) == cbor::error::not_found);
+
+      auto truncated = message;
+      truncated.pop_back();
+      REQUIRE(cbor::locate(truncated, ttl, location) == cbor::error::buffer_underflow);
+   }
+}
+
+TEST_CASE("Field update - integer keys and tags", "[field_update]") {
+   const std::map<std::int64_t, std::string> value{{-30, "minus thirty"}, {-1, "minus one"}, {0, "zero"}, {70000, "big"}};
+
+   std::vector<std::byte> message{};
+   cbor::dynamic_buffer buf{message};
+
+   // Tagged container
+   REQUIRE(!cbor::encode_argument(buf, cbor::major_type::tag, 55799U));
+   REQUIRE(!cbor::encode(buf, value));
+
+   for (const auto &[k, v] : value) {
+      REQUIRE(decode_field<std::string>(message, {cbor::path_element::int_key(k)}) == v);
+   }
+
+   cbor::field_location location{};
+   const cbor::path_element missing[] = {cbor::path_element::int_key(-2)};
+   REQUIRE(cbor::locate(message, missing, location) == cbor::error::not_found);
+
+   const cbor::path_element text_key[] = {"zero"};
+   REQUIRE(cbor::locate(message, text_key, location) == cbor::error::not_found);
+}
+
+TEST_CASE("Field update - in place", "[field_update]") {
+   auto message = make_message();
+   const auto original_size = message.size();
+
+   // Same width
+   REQUIRE(!cbor::update_in_place(message, {"ttl"}, 299));
+   REQUIRE(decode_field<std::int64_t>(message, {"ttl"}) == 299);
+
+   // Narrower value keeps the existing head width
+   REQUIRE(!cbor::update_in_place(message, {"ttl"}, 5));
+   REQUIRE(decode_field<std::int64_t>(message, {"ttl"}) == 5);
+   REQUIRE(message.size() == original_size);
+
+   // The major type may change, as long as the width stays the same
+   REQUIRE(!cbor::update_in_place(message, {"ttl"}, -1000));
+   REQUIRE(decode_field<std::int64_t>(message, {"ttl"}) == -1000);
+
+   // Strings of the same length
+   REQUIRE(!cbor::update_in_place(message, {"origin"}, std::string{"service"}));
+   REQUIRE(decode_field<std::string>(message, {"origin"}) == "service");
+
+   // Neighbours are not affected
+   REQUIRE(decode_field<std::vector<std::int64_t>>(message, {"hops"}) == std::vector<std::int64_t>{1, 2, 3});
+
+   SECTION("Values that don't fit") {
+      const auto before = message;
+      REQUIRE(cbor::update_in_place(message, {"ttl"}, 70000) == cbor::error::value_not_representable);
+      REQUIRE(cbor::update_in_place(message, {"hops", 0}, 24) == cbor::error::value_not_representable);
+      REQUIRE(cbor::update_in_place(message, {"origin"}, std::string{"proxy"}) == cbor::error::value_not_representable);
+      REQUIRE(cbor::update_in_place(message, {"ttl"}, 1.1) == cbor::error::value_not_representable);
+      REQUIRE(cbor::update_in_place(message, {"missing"}, 1) == cbor::error::not_found);
+      REQUIRE(message == before);
+   }
+}
+
+TEST_CASE("Field update - splicing", "[field_update]") {
+   auto message = make_message();
+
+   REQUIRE(!cbor::update(message, {"hops", 0}, 1000000));
+   REQUIRE(!cbor::update(message, {"origin"}, std::string{"gw"}));
+   REQUIRE(!cbor::update(message, {"ttl"}, 1));
+   REQUIRE(!cbor::update(message, {"hops", 2}, std::int64_t{-1}));
+
+   REQUIRE(decode_field<std::vector<std::int64_t>>(message, {"hops"}) == std::vector<std::int64_t>{1000000, 2, -1});
+   REQUIRE(decode_field<std::string>(message, {"origin"}) == "gw");
+   REQUIRE(decode_field<std::int64_t>(message, {"ttl"}) == 1);
+
+   // The result is a well-formed message
+   cbor::read_buffer buf{message};
+   REQUIRE(!cbor::skip(buf));
+   REQUIRE(static_cast<std::size_t>(buf.read_position()) == message.size());
+
+   SECTION("Replacing containers") {
+      REQUIRE(!cbor::update(message, {"hops"}, std::vector<std::int64_t>{}));
+      REQUIRE(decode_field<std::vector<std::int64_t>>(message, {"hops"}).empty());
+      REQUIRE(decode_field<std::string>(message, {"origin"}) == "gw");
+   }
+
+   SECTION("Replacing the whole message") {
+      REQUIRE(!cbor::update(message, {}, std::string{"replaced"}));
+      REQUIRE(decode_field<std::string>(message, {}) == "replaced");
+   }
+}
@@ -0,0 +1,215 @@
+/**
+ * @file   file_buffer.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#if !defined(_WIN32)
+
+#include <cbor/cbor.h>
+#include <cbor/file_buffer.h>
+
+#include <test/testing_hooks.h>
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace cbor;
+
+namespace {
+
+std::vector<std::byte> read_file(const std::filesystem::path &path) {
+   std::ifstream in{path, std::ios::binary};
+   std::vector<char> chars{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+
+   std::vector<std::byte> result(chars.size());
+   std::memcpy(result.data(), chars.data(), chars.size());
+   return result;
+}
+
+std::vector<std::string> read_strings(file_reader &reader) {
+   std::vector<std::string> result;
+   do {
+      read_buffer buf{reader.data()};
+      std::ptrdiff_t consumed = 0;
+
+      std::string value;
+      while (!cbor::decode(buf, value)) {
+         consumed = buf.read_position();
+         result.push_back(value);
+      }
+      reader.consume(static_cast<std::size_t>(consumed));
+   } while (!reader.next());
+
+   return result;
+}
+
+} // namespace
+
+TEST_CASE("File buffer - round trip", "[file_buffer]") {
+   const bool use_io_uring = GENERATE(true, false);
+   const auto path = std::filesystem::temp_directory_path() / "cbor_file_buffer_test.cbor";
+
+   std::vector<std::string> expected;
+   for (std::size_t i = 0; i < 2000; ++i) {
+      expected.emplace_back(i % 97, static_cast<char>('a' + i % 26));
+   }
+
+   {
+      file_writer writer{64, use_io_uring};
+      REQUIRE(writer.write(std::byte{0}) == error::invalid_usage);
+
+      REQUIRE(!writer.open(path));
+      if (!use_io_uring) {
+         REQUIRE(!writer.uses_io_uring());
+      }
+
+      for (const auto &v : expected) {
+         REQUIRE(!cbor::encode(writer, v));
+      }
+
+      const auto size = writer.size();
+      REQUIRE(!writer.close());
+      REQUIRE(std::filesystem::file_size(path) == size);
+   }
+
+   SECTION("Matches in-memory encoding") {
+      std::vector<std::byte> data;
+      dynamic_buffer buf{data};
+      for (const auto &v : expected) {
+         REQUIRE(!cbor::encode(buf, v));
+      }
+
+      REQUIRE(read_file(path) == data);
+   }
+
+   SECTION("Items are carried over window boundaries") {
+      file_reader reader{128, use_io_uring};
+      REQUIRE(!reader.open(path));
+      REQUIRE(read_strings(reader) == expected);
+      REQUIRE(reader.data().empty());
+      REQUIRE(reader.next() == error::buffer_underflow);
+   }
+
+   SECTION("Items have to fit into a window") {
+      file_reader reader{64, use_io_uring};
+      REQUIRE(!reader.open(path));
+
+      std::error_code res;
+      do {
+         res = reader.next();
+      } while (!res);
+      REQUIRE(res == error::buffer_overflow);
+   }
+
+   std::filesystem::remove(path);
+}
+
+TEST_CASE("File buffer - rollbacks", "[file_buffer]") {
+   const bool use_io_uring = GENERATE(true, false);
+   const auto path = std::filesystem::temp_directory_path() / "cbor_file_buffer_rollback.cbor";
+
+   file_writer writer{16, use_io_uring};
+   REQUIRE(!writer.open(path));
+
+   REQUIRE(!cbor::encode(writer, std::string{"first"}));
+   const auto expected_size = writer.size();
+
+   SECTION("Within a staging area") {
+      {
+         auto rollback_helper = writer.get_rollback_helper();
+         REQUIRE(!cbor::encode(writer, std::string{"abc"}));
+      }
+      REQUIRE(writer.size() == expected_size);
+   }
+
+   SECTION("Across staging areas") {
+      {
+         auto rollback_helper = writer.get_rollback_helper();
+         REQUIRE(!cbor::encode(writer, std::string(100, 'x')));
+         REQUIRE(!writer.flush());
+      }
+      REQUIRE(writer.size() == expected_size);
+   }
+
+   REQUIRE(!cbor::encode(writer, std::string{"second"}));
+   REQUIRE(!writer.close());
+
+   file_reader reader{32, use_io_uring};
+   REQUIRE(!reader.open(path));
+   REQUIRE(read_strings(reader) == std::vector<std::string>{"first", "second"});
+
+   std::filesystem::remove(path);
+}
+
+#if CBOR_WITH(TESTING_HOOKS)
+TEST_CASE("File buffer - io_uring fallback with operations in flight", "[file_buffer]") {
+   const auto path = std::filesystem::temp_directory_path() / "cbor_file_buffer_fallback.cbor";
+
+   std::vector<std::string> expected;
+   for (std::size_t i = 0; i < 200; ++i) {
+      expected.emplace_back(i % 13, static_cast<char>('a' + i % 26));
+   }
+
+   file_writer writer{16};
+   REQUIRE(!writer.open(path));
+   if (!writer.uses_io_uring()) {
+      // Nothing to fall back from
+      return;
+   }
+
+   // The first reaped completion arrives while both staging areas are in flight
+   detail::override_next_io_uring_result(-EINVAL);
+
+   for (const auto &v : expected) {
+      REQUIRE(!cbor::encode(writer, v));
+   }
+   REQUIRE(!writer.uses_io_uring());
+   REQUIRE(!writer.close());
+
+   file_reader reader{32};
+   REQUIRE(!reader.open(path));
+   REQUIRE(read_strings(reader) == expected);
+
+   std::filesystem::remove(path);
+}
+#endif // CBOR_WITH(TESTING_HOOKS)
+
+TEST_CASE("File buffer - edge cases", "[file_buffer]") {
+   const auto path = std::filesystem::temp_directory_path() / "cbor_file_buffer_edge.cbor";
+
+   SECTION("Empty files") {
+      file_writer writer{};
+      REQUIRE(!writer.open(path));
+      REQUIRE(!writer.close());
+      REQUIRE(std::filesystem::file_size(path) == 0);
+
+      file_reader reader{};
+      REQUIRE(!reader.open(path));
+      REQUIRE(reader.data().empty());
+      REQUIRE(reader.next() == error::buffer_underflow);
+   }
+
+   SECTION("Missing files") {
+      std::filesystem::remove(path);
+
+      file_reader reader{};
+      REQUIRE(reader.open(path));
+      REQUIRE(reader.next() == error::invalid_usage);
+
+      file_writer writer{};
+      REQUIRE(writer.open(std::filesystem::temp_directory_path() / "missing" / "directory.cbor"));
+   }
+
+   std::filesystem::remove(path);
+}
+
+#endif // !defined(_WIN32)
@@ -0,0 +1,182 @@
+/**
+ * @file   message_queue.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cbor/cbor.h>
+#include <cbor/message_queue.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace cbor;
+
+namespace {
+
+std::uint64_t decode_id(buffer::const_span_t message) {
+   read_buffer buf{message};
+
+   std::uint64_t result{};
+   REQUIRE(!cbor::decode(buf, result));
+   return result;
+}
+
+} // namespace
+
+TEST_CASE("Message queue - basic operations", "[message_queue]") {
+   message_queue queue{3, 16};
+   REQUIRE(queue.slot_count() == 4);
+   REQUIRE(queue.slot_size() == 16);
+
+   std::vector<std::uint64_t> ids{};
+   auto collect = [&ids](buffer::const_span_t message) { ids.push_back(decode_id(message)); };
+
+   REQUIRE(queue.drain(collect) == 0);
+
+   SECTION("Messages are consumed in order") {
+      for (std::uint64_t i = 0; i < 4; ++i) {
+         REQUIRE(!queue.push(i * 100));
+      }
+
+      // Full
+      REQUIRE(queue.push(std::uint64_t{5}) == error::buffer_overflow);
+
+      REQUIRE(queue.drain(collect, 3) == 3);
+      REQUIRE(ids == std::vector<std::uint64_t>{0, 100, 200});
+
+      REQUIRE(!queue.push(std::uint64_t{400}));
+      REQUIRE(queue.drain(collect) == 2);
+      REQUIRE(ids == std::vector<std::uint64_t>{0, 100, 200, 300, 400});
+   }
+
+   SECTION("Oversized messages are discarded") {
+      REQUIRE(queue.push(std::string(20, 'x')) == error::buffer_overflow);
+      REQUIRE(!queue.push(std::uint64_t{1}));
+
+      REQUIRE(queue.drain(collect) == 1);
+      REQUIRE(ids == std::vector<std::uint64_t>{1});
+   }
+
+   SECTION("Writers can encode directly into slots") {
+      message_queue::writer first{};
+      REQUIRE(!first.has_slot());
+      REQUIRE(first.write(std::byte{0}) == error::invalid_usage);
+
+      message_queue::writer second{};
+      REQUIRE(!queue.reserve(first));
+      REQUIRE(!queue.reserve(second));
+      REQUIRE(first.has_slot());
+
+      REQUIRE(!encode(second, std::uint64_t{2}));
+      second.publish();
+      REQUIRE(!second.has_slot());
+
+      // The first slot blocks consumers until published
+      REQUIRE(queue.drain(collect) == 0);
+
+      REQUIRE(!encode(first, std::uint64_t{1}));
+      {
+         // Rollbacks work as usual
+         auto rollback_helper = first.get_rollback_helper();
+         REQUIRE(!encode(first, std::uint64_t{1000}));
+      }
+      REQUIRE(first.size() == 1);
+
+      {
+         // Moving a writer keeps the reservation
+         message_queue::writer moved{std::move(first)};
+         REQUIRE(!first.has_slot());
+         moved.publish();
+      }
+
+      {
+         // Unpublished slots are discarded on destruction
+         message_queue::writer abandoned{};
+         REQUIRE(!queue.reserve(abandoned));
+         REQUIRE(!encode(abandoned, std::uint64_t{3}));
+      }
+
+      REQUIRE(queue.drain(collect) == 2);
+      REQUIRE(ids == std::vector<std::uint64_t>{1, 2});
+   }
+}
+
+TEST_CASE("Message queue - concurrent producers and consumers", "[message_queue]") {
+   constexpr std::uint64_t num_producers = 4;
+   constexpr std::uint64_t num_consumers = 2;
+   constexpr std::uint64_t messages_per_producer = 10000;
+   constexpr std::uint64_t total_messages = num_producers * messages_per_producer;
+
+   message_queue queue{64, 32};
+
+   std::vector<std::thread> producers{};
+   for (std::uint64_t p = 0; p < num_producers; ++p) {
+      producers.emplace_back([&queue, p] {
+         for (std::uint64_t i = 0; i < messages_per_producer;) {
+            if (queue.push(p * messages_per_producer + i)) {
+               std::this_thread::yield();
+               continue;
+            }
+            ++i;
+         }
+      });
+   }
+
+   std::atomic<std::uint64_t> consumed{0};
+   std::vector<std::vector<std::uint64_t>> received(num_consumers);
+
+   std::vector<std::thread> consumers{};
+   for (std::uint64_t c = 0; c < num_consumers; ++c) {
+      consumers.emplace_back([&, c] {
+         while (consumed.load() < total_messages) {
+            const auto count = queue.drain(
+               [&](buffer::const_span_t message) {
+                  read_buffer buf{message};
+                  std::uint64_t id{};
+                  if (!cbor::decode(buf, id)) {
+                     received[c].push_back(id);
+                  }
+               },
+               16);
+
+            consumed += count;
+            if (count == 0) {
+               std::this_thread::yield();
+            }
+         }
+      });
+   }
+
+   for (auto &t : producers) {
+      t.join();
+   }
+
+   for (auto &t : consumers) {
+      t.join();
+   }
+
+   std::vector<std::uint64_t> all{};
+   for (const auto &r : received) {
+      // Each producer's messages are consumed in order by every single consumer
+      for (std::uint64_t p = 0; p < num_producers; ++p) {
+         std::vector<std::uint64_t> from_producer{};
+         std::copy_if(r.begin(), r.end(), std::back_inserter(from_producer),
+                      [p](auto id) { return id / messages_per_producer == p; });
+         REQUIRE(std::is_sorted(from_producer.begin(), from_producer.end()));
+      }
+
+      all.insert(all.end(), r.begin(), r.end());
+   }
+
+   std::sort(all.begin(), all.end());
+   REQUIRE(all.size() == total_messages);
+   for (std::uint64_t i = 0; i < total_messages; ++i) {
+      REQUIRE(all[i] == i);
+   }
+}
@@ -0,0 +1,230 @@
+/**
+ * @file   schema.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ *
+ * Ensure that schema fingerprints reflect the encoding layout, and that trusted decoding matches the checked one.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cbor/schema.h>
+
+#include <test/encoding.h>
+
+#include <bitset>
+#include <map>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace test;
+
+namespace {
+
+enum class level : std::uint8_t {
+   low,
+   high,
+};
+
+struct point {
+   std::int32_t x;
+   std::int32_t y;
+
+   CBOR_FIELDS(point, x, y)
+};
+
+struct shape {
+   std::string name;
+   std::vector<point> points;
+   std::optional<level> fill;
+   std::map<std::string, std::uint64_t> attributes;
+   std::vector<std::byte> blob;
+   double scale;
+   bool closed;
+
+   CBOR_FIELDS(shape, name, points, fill, attributes, blob, scale, closed)
+};
+
+//! Same as point, but with a different name and member names
+struct vector2 {
+   std::int32_t dx;
+   std::int32_t dy;
+
+   CBOR_FIELDS(vector2, dx, dy)
+};
+
+//! Same as point, but with different member types
+struct wide_point {
+   std::int64_t x;
+   std::int64_t y;
+
+   CBOR_FIELDS(wide_point, x, y)
+};
+
+struct ping {
+   std::uint64_t sequence;
+
+   CBOR_FIELDS(ping, sequence)
+};
+
+struct pong {
+   std::uint64_t sequence;
+   std::int64_t delay;
+
+   CBOR_FIELDS(pong, sequence, delay)
+};
+
+} // namespace
+
+template <>
+struct cbor::type_id<ping> : std::integral_constant<std::uint64_t, 0x01> {};
+
+template <>
+struct cbor::type_id<pong> : std::integral_constant<std::uint64_t, 0x02> {};
+
+using message_t = std::variant<ping, pong>;
+using reversed_message_t = std::variant<pong, ping>;
+
+// Fingerprints are compile-time constants, only depending on the encoding layout
+static_assert(cbor::schema_fingerprint_v<point> == cbor::schema_fingerprint_v<vector2>);
+static_assert(cbor::schema_fingerprint_v<point> != cbor::schema_fingerprint_v<wide_point>);
+static_assert(cbor::schema_fingerprint_v<shape> != cbor::schema_fingerprint_v<point>);
+static_assert(cbor::schema_fingerprint_v<std::vector<point>> != cbor::schema_fingerprint_v<std::array<point, 2>>);
+static_assert(cbor::schema_fingerprint_v<std::vector<std::byte>> != cbor::schema_fingerprint_v<std::vector<bool>>);
+static_assert(cbor::schema_fingerprint_v<std::vector<bool>> != cbor::schema_fingerprint_v<std::vector<std::uint8_t>>);
+static_assert(cbor::schema_fingerprint_v<std::bitset<8>> != cbor::schema_fingerprint_v<std::bitset<16>>);
+static_assert(cbor::schema_fingerprint_v<level> == cbor::schema_fingerprint_v<std::uint8_t>);
+static_assert(cbor::schema_fingerprint_v<std::optional<point>> != cbor::schema_fingerprint_v<point>);
+static_assert(cbor::schema_fingerprint_v<message_t> != cbor::schema_fingerprint_v<reversed_message_t>);
+static_assert(cbor::schema_fingerprint_v<cbor::encoded<point>> == cbor::schema_fingerprint_v<point>);
+
+namespace {
+
+shape make_shape() {
+   return {
+      .name = "triangle",
+      .points = {{0, 0}, {-100, 5}, {70000, -70000}},
+      .fill = level::high,
+      .attributes = {{"layer", 3}, {"z", 0xFFFFFFFFFFULL}},
+      .blob = {std::byte{1}, std::byte{2}},
+      .scale = 1.5,
+      .closed = true,
+   };
+}
+
+bool operator==(const point &lhs, const point &rhs) {
+   return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+void compare(const shape &lhs, const shape &rhs) {
+   REQUIRE(lhs.name == rhs.name);
+   REQUIRE(lhs.points == rhs.points);
+   REQUIRE(lhs.fill == rhs.fill);
+   REQUIRE(lhs.attributes == rhs.attributes);
+   REQUIRE(lhs.blob == rhs.blob);
+   REQUIRE(lhs.scale == rhs.scale);
+   REQUIRE(lhs.closed == rhs.closed);
+}
+
+} // namespace
+
+TEST_CASE("Schema - fingerprint exchange", "[schema]") {
+   std::vector<std::byte> bytes{};
+   cbor::dynamic_buffer buf{bytes};
+   REQUIRE(!cbor::encode_fingerprint<shape>(buf));
+
+   SECTION("Matching schema") {
+      cbor::read_buffer read_buf{bytes};
+      bool matches = false;
+      REQUIRE(!cbor::decode_fingerprint<shape>(read_buf, matches));
+      REQUIRE(matches);
+   }
+
+   SECTION("Different schema") {
+      cbor::read_buffer read_buf{bytes};
+      bool matches = true;
+      REQUIRE(!cbor::decode_fingerprint<point>(read_buf, matches));
+      REQUIRE(!matches);
+   }
+}
+
+TEST_CASE("Schema - trusted decoding", "[schema]") {
+   const auto expected = make_shape();
+
+   std::vector<std::byte> bytes{};
+   cbor::dynamic_buffer buf{bytes};
+   REQUIRE(!cbor::encode(buf, expected));
+
+   shape checked{};
+   cbor::read_buffer checked_buf{bytes};
+   REQUIRE(!cbor::decode(checked_buf, checked));
+
+   shape trusted{};
+   cbor::read_buffer trusted_buf{bytes};
+   REQUIRE(!cbor::decode_trusted(trusted_buf, trusted));
+
+   compare(checked, expected);
+   compare(trusted, expected);
+   REQUIRE(trusted_buf.read_position() == checked_buf.read_position());
+
+   SECTION("Empty optionals and containers") {
+      shape empty{};
+      bytes.clear();
+      REQUIRE(!cbor::encode(buf, empty));
+
+      shape decoded = make_shape();
+
+      // Dictionaries are extended, same as with the checked decoding
+      decoded.attributes.clear();
+
+      cbor::read_buffer read_buf{bytes};
+      REQUIRE(!cbor::decode_trusted(read_buf, decoded));
+      compare(decoded, empty);
+   }
+
+   SECTION("Variants") {
+      const message_t msg = pong{.sequence = 10, .delay = -3};
+      bytes.clear();
+      REQUIRE(!cbor::encode(buf, msg));
+
+      message_t decoded{};
+      cbor::read_buffer read_buf{bytes};
+      REQUIRE(!cbor::decode_trusted(read_buf, decoded));
+      REQUIRE(std::holds_alternative<pong>(decoded));
+      REQUIRE(std::get<pong>(decoded).sequence == 10);
+      REQUIRE(std::get<pong>(decoded).delay == -3);
+   }
+}
+
+TEST_CASE("Schema - trusted decoding errors", "[schema, errors]") {
+   SECTION("Truncated input") {
+      std::vector<std::byte> bytes{};
+      cbor::dynamic_buffer buf{bytes};
+      REQUIRE(!cbor::encode(buf, make_shape()));
+      bytes.resize(bytes.size() / 2);
+
+      shape decoded{};
+      cbor::read_buffer read_buf{bytes};
+      REQUIRE(cbor::decode_trusted(read_buf, decoded) == cbor::error::buffer_underflow);
+   }
+
+   SECTION("Container sizes are bound by the input size") {
+      // An array claiming 0xFFFFFFFF elements
+      const std::array source{0x9A_b, 0xFF_b, 0xFF_b, 0xFF_b, 0xFF_b, 0x01_b};
+      cbor::read_buffer read_buf{cbor::buffer::const_span_t{source}};
+
+      std::vector<point> decoded{};
+      REQUIRE(cbor::decode_trusted(read_buf, decoded) == cbor::error::buffer_underflow);
+      REQUIRE(decoded.empty());
+   }
+
+   SECTION("Unknown variant alternative") {
+      const std::array source{0x82_b, 0x03_b, 0x81_b, 0x01_b};
+      cbor::read_buffer read_buf{cbor::buffer::const_span_t{source}};
+
+      message_t decoded{};
+      REQUIRE(cbor::decode_trusted(read_buf, decoded) == cbor::error::unexpected_type);
+   }
+}
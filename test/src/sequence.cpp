@@ -0,0 +1,249 @@
+/**
+ * @file   sequence.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cbor/cbor.h>
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace cbor;
+
+namespace {
+
+using span_t = buffer::const_span_t;
+
+struct item {
+   std::uint64_t id;
+   std::string name;
+};
+
+[[nodiscard]] std::error_code encode(buffer &buf, const item &v) {
+   auto rollback_helper = buf.get_rollback_helper();
+
+   auto res = encode_argument(buf, major_type::array, 2U);
+   if (res) {
+      return res;
+   }
+
+   res = cbor::encode(buf, v.id);
+   if (res) {
+      return res;
+   }
+
+   res = cbor::encode(buf, v.name);
+   if (res) {
+      return res;
+   }
+
+   rollback_helper.commit();
+   return res;
+}
+
+//! Decode the ID of an encoded item, skipping the name
+std::uint64_t decode_id(read_buffer &buf) {
+   detail::head head{};
+   REQUIRE(!head.read(buf));
+   REQUIRE(head.decode_argument() == 2);
+
+   std::uint64_t id{};
+   REQUIRE(!cbor::decode(buf, id));
+   REQUIRE(!cbor::skip(buf));
+   return id;
+}
+
+std::vector<std::byte> make_sequence(std::uint64_t count) {
+   std::vector<std::byte> result{};
+   dynamic_buffer buf{result};
+
+   for (std::uint64_t i = 0; i < count; ++i) {
+      // Variable item sizes
+      REQUIRE(!encode(buf, item{.id = i * 1000, .name = std::string(i % 7, 'x')}));
+   }
+
+   return result;
+}
+
+} // namespace
+
+TEST_CASE("Sequence index - seeking", "[sequence]") {
+   const auto sequence = make_sequence(100);
+
+   sequence_index index{8};
+   REQUIRE(!index.build(span_t{sequence}));
+   REQUIRE(index.item_count() == 100);
+   REQUIRE(index.offsets().size() == 13);
+   REQUIRE(index.offsets()[0] == 0);
+
+   read_buffer buf{span_t{sequence}};
+
+   SECTION("Every item is reachable") {
+      for (std::uint64_t i = 0; i < 100; ++i) {
+         REQUIRE(!index.seek(buf, i));
+         REQUIRE(decode_id(buf) == i * 1000);
+      }
+   }
+
+   SECTION("Seeking past the last item") {
+      REQUIRE(!index.seek(buf, 100));
+      REQUIRE(buf.read_position() == sequence.size());
+
+      buf.reset(3);
+      REQUIRE(index.seek(buf, 101) == error::buffer_underflow);
+      REQUIRE(buf.read_position() == 3);
+   }
+
+   SECTION("Seeking in a different sequence") {
+      std::vector<std::byte> other{sequence.begin(), sequence.end() - 1};
+      read_buffer other_buf{span_t{other}};
+      REQUIRE(index.seek(other_buf, 1) == error::invalid_usage);
+   }
+}
+
+TEST_CASE("Sequence index - building errors", "[sequence, errors]") {
+   auto sequence = make_sequence(10);
+   sequence.pop_back();
+
+   sequence_index index{4};
+   REQUIRE(index.build(span_t{sequence}) == error::buffer_underflow);
+   REQUIRE(index.item_count() == 0);
+   REQUIRE(index.offsets().empty());
+}
+
+TEST_CASE("Sequence index - partitioning", "[sequence]") {
+   const auto sequence = make_sequence(50);
+
+   sequence_index index{5};
+   REQUIRE(!index.build(span_t{sequence}));
+
+   for (std::size_t count : {1U, 3U, 10U, 20U}) {
+      const auto parts = index.partition(span_t{sequence}, count);
+      REQUIRE(parts.size() == std::min<std::size_t>(count, 10));
+
+      // Parts should be contiguous and independently decodable
+      std::uint64_t expected_id = 0;
+      const std::byte *expected_start = sequence.data();
+      for (const auto &part : parts) {
+         REQUIRE(part.data() == expected_start);
+         expected_start += part.size();
+
+         read_buffer buf{part};
+         while (static_cast<std::size_t>(buf.read_position()) < part.size()) {
+            REQUIRE(decode_id(buf) == expected_id);
+            expected_id += 1000;
+         }
+      }
+      REQUIRE(expected_id == 50 * 1000);
+   }
+}
+
+TEST_CASE("Sequence index - sidecar round trip", "[sequence]") {
+   const auto sequence = make_sequence(33);
+
+   sequence_index index{4};
+   REQUIRE(!index.build(span_t{sequence}));
+
+   std::vector<std::byte> sidecar{};
+   dynamic_buffer out{sidecar};
+   REQUIRE(!encode(out, index));
+
+   read_buffer in{span_t{sidecar}};
+   sequence_index decoded{};
+   REQUIRE(!decode(in, decoded));
+   REQUIRE(in.read_position() == sidecar.size());
+
+   REQUIRE(decoded.stride() == index.stride());
+   REQUIRE(decoded.item_count() == index.item_count());
+   REQUIRE(decoded.sequence_size() == index.sequence_size());
+   REQUIRE(decoded.offsets() == index.offsets());
+
+}
+
+TEST_CASE("Sequence index - sidecar errors", "[sequence, errors]") {
+   //! Encode a sidecar with the given contents, as is
+   const auto make_sidecar = [](std::uint64_t stride, std::uint64_t item_count, std::uint64_t sequence_size,
+                                const std::vector<std::uint64_t> &deltas) {
+      std::vector<std::byte> result{};
+      dynamic_buffer buf{result};
+      REQUIRE(!encode_argument(buf, major_type::array, 4U));
+      REQUIRE(!cbor::encode(buf, stride));
+      REQUIRE(!cbor::encode(buf, item_count));
+      REQUIRE(!cbor::encode(buf, sequence_size));
+      REQUIRE(!cbor::encode(buf, deltas));
+      return result;
+   };
+
+   sequence_index decoded{};
+
+   SECTION("Consistent sidecar") {
+      const auto sidecar = make_sidecar(2, 3, 10, {0, 4});
+      read_buffer in{span_t{sidecar}};
+      REQUIRE(!decode(in, decoded));
+      REQUIRE(decoded.offsets() == std::vector<std::uint64_t>{0, 4});
+   }
+
+   SECTION("Missing offsets") {
+      const auto sidecar = make_sidecar(2, 5, 10, {0, 4});
+      read_buffer in{span_t{sidecar}};
+      REQUIRE(decode(in, decoded) == error::decoding_error);
+   }
+
+   SECTION("Item count close to the integer limit") {
+      // Rounding the number of entries up must not wrap around to zero
+      const auto sidecar = make_sidecar(2, std::numeric_limits<std::uint64_t>::max(), 10, {});
+      read_buffer in{span_t{sidecar}};
+      REQUIRE(decode(in, decoded) == error::decoding_error);
+   }
+
+   SECTION("Offsets past the sequence end") {
+      const auto sidecar = make_sidecar(2, 3, 10, {0, 11});
+      read_buffer in{span_t{sidecar}};
+      REQUIRE(decode(in, decoded) == error::decoding_error);
+   }
+
+   SECTION("Zero stride") {
+      const auto sidecar = make_sidecar(0, 3, 10, {0, 4});
+      read_buffer in{span_t{sidecar}};
+      REQUIRE(decode(in, decoded) == error::decoding_error);
+   }
+}
+
+TEST_CASE("Mapped file - seeking in a file", "[sequence, mapped_file]") {
+   const auto sequence = make_sequence(20);
+   const auto path = std::filesystem::temp_directory_path() / "cbor_mapped_file_test.cbor";
+
+   {
+      std::ofstream out{path, std::ios::binary | std::ios::trunc};
+      out.write(reinterpret_cast<const char *>(sequence.data()), static_cast<std::streamsize>(sequence.size()));
+   }
+
+   {
+      mapped_file file{};
+      REQUIRE(!file.open(path));
+      REQUIRE(file.is_open());
+      REQUIRE(file.data().size() == sequence.size());
+
+      sequence_index index{3};
+      REQUIRE(!index.build(file.data()));
+
+      mapped_file moved{std::move(file)};
+      REQUIRE(!file.is_open());
+
+      read_buffer buf{moved.data()};
+      REQUIRE(!index.seek(buf, 17));
+      REQUIRE(decode_id(buf) == 17000);
+   }
+
+   std::filesystem::remove(path);
+
+   mapped_file missing{};
+   REQUIRE(missing.open(path));
+   REQUIRE(!missing.is_open());
+}
@@ -0,0 +1,289 @@
+/**
+ * @file   shared_ring.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cbor/config.h>
+
+#if CBOR_WITH(SHARED_MEMORY)
+
+#include <cbor/cbor.h>
+#include <cbor/shared_ring.h>
+
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace cbor;
+
+namespace {
+
+struct message {
+   std::uint64_t id;
+   std::string payload;
+};
+
+[[nodiscard]] std::error_code encode(buffer &buf, const message &v) {
+   auto rollback_helper = buf.get_rollback_helper();
+
+   auto res = encode_argument(buf, major_type::array, 2U);
+   if (res) {
+      return res;
+   }
+
+   res = cbor::encode(buf, v.id);
+   if (res) {
+      return res;
+   }
+
+   res = cbor::encode(buf, v.payload);
+   if (res) {
+      return res;
+   }
+
+   rollback_helper.commit();
+   return res;
+}
+
+message decode_message(buffer::const_span_t bytes) {
+   read_buffer buf{bytes};
+
+   detail::head head{};
+   REQUIRE(!head.read(buf));
+   REQUIRE(head.decode_argument() == 2);
+
+   message result{};
+   REQUIRE(!cbor::decode(buf, result.id));
+   REQUIRE(!cbor::decode(buf, result.payload));
+   REQUIRE(buf.read_position() == bytes.size());
+   return result;
+}
+
+} // namespace
+
+TEST_CASE("Shared ring - basic messaging", "[shared_ring]") {
+   shared_ring ring{};
+   REQUIRE(!ring.create(100));
+   REQUIRE(ring.is_open());
+   REQUIRE(ring.capacity() >= 4096);
+
+   ring_writer writer{ring};
+   ring_reader reader{ring};
+
+   buffer::const_span_t view{};
+   REQUIRE(reader.peek(view) == error::buffer_underflow);
+
+   REQUIRE(!encode(writer, message{1, "one"}));
+
+   // Not visible before committing
+   REQUIRE(reader.peek(view) == error::buffer_underflow);
+
+   REQUIRE(!writer.commit());
+   REQUIRE(writer.size() == 0);
+
+   REQUIRE(!reader.peek(view));
+   const auto decoded = decode_message(view);
+   REQUIRE(decoded.id == 1);
+   REQUIRE(decoded.payload == "one");
+
+   // Peeking again returns the same message
+   buffer::const_span_t again{};
+   REQUIRE(!reader.peek(again));
+   REQUIRE(again.data() == view.data());
+
+   reader.release();
+   REQUIRE(reader.peek(view) == error::buffer_underflow);
+
+   SECTION("Discarded messages are never published") {
+      REQUIRE(!encode(writer, message{2, "two"}));
+      writer.discard();
+      REQUIRE(!writer.commit());
+
+      REQUIRE(!reader.peek(view));
+      REQUIRE(view.empty());
+   }
+}
+
+TEST_CASE("Shared ring - overflows and wrap-arounds", "[shared_ring]") {
+   shared_ring ring{};
+   REQUIRE(!ring.create(4096));
+
+   ring_writer writer{ring};
+   ring_reader reader{ring};
+
+   SECTION("Failed encoding is rolled back") {
+      REQUIRE(!encode(writer, message{1, std::string(1000, 'a')}));
+      REQUIRE(!writer.commit());
+
+      // Doesn't fit into the remaining space, leaves nothing behind
+      REQUIRE(encode(writer, message{2, std::string(3500, 'b')}) == error::buffer_overflow);
+      REQUIRE(writer.size() == 0);
+
+      // Releasing the first message makes enough space
+      buffer::const_span_t view{};
+      REQUIRE(!reader.peek(view));
+      reader.release();
+
+      REQUIRE(!encode(writer, message{2, std::string(3500, 'b')}));
+      REQUIRE(!writer.commit());
+
+      REQUIRE(!reader.peek(view));
+      REQUIRE(decode_message(view).payload == std::string(3500, 'b'));
+   }
+
+   SECTION("Messages stay contiguous across the ring end") {
+      for (std::uint64_t i = 0; i < 1000; ++i) {
+         const message expected{i, std::string(100 + i % 50, static_cast<char>('a' + i % 26))};
+         REQUIRE(!encode(writer, expected));
+         REQUIRE(!writer.commit());
+
+         buffer::const_span_t view{};
+         REQUIRE(!reader.peek(view));
+
+         const auto decoded = decode_message(view);
+         REQUIRE(decoded.id == expected.id);
+         REQUIRE(decoded.payload == expected.payload);
+
+         reader.release();
+      }
+   }
+}
+
+TEST_CASE("Shared ring - attaching", "[shared_ring]") {
+   shared_ring producer_ring{};
+   REQUIRE(!producer_ring.create(8192));
+
+   // A separate mapping of the same memory, as it would be done in another process
+   shared_ring consumer_ring{};
+   REQUIRE(!consumer_ring.attach(producer_ring.fd()));
+   REQUIRE(consumer_ring.capacity() == producer_ring.capacity());
+   REQUIRE(consumer_ring.fd() != producer_ring.fd());
+
+   ring_writer writer{producer_ring};
+   ring_reader reader{consumer_ring};
+
+   REQUIRE(!encode(writer, message{42, "hello"}));
+   REQUIRE(!writer.commit());
+
+   buffer::const_span_t view{};
+   REQUIRE(!reader.peek(view));
+   REQUIRE(decode_message(view).id == 42);
+
+   SECTION("Attaching to unrelated descriptors fails") {
+      shared_ring other{};
+      REQUIRE(other.attach(-1));
+      REQUIRE(!other.is_open());
+   }
+}
+
+TEST_CASE("Shared ring - errors", "[shared_ring, errors]") {
+   SECTION("Closed rings") {
+      shared_ring ring{};
+
+      ring_writer writer{ring};
+      REQUIRE(writer.write(std::byte{0}) == error::invalid_usage);
+      REQUIRE(writer.commit() == error::invalid_usage);
+
+      ring_reader reader{ring};
+      buffer::const_span_t view{};
+      REQUIRE(reader.peek(view) == error::invalid_usage);
+   }
+
+   SECTION("Corrupted message sizes") {
+      shared_ring ring{};
+      REQUIRE(!ring.create(4096));
+
+      ring_writer writer{ring};
+      REQUIRE(!encode(writer, message{1, "corrupted"}));
+      REQUIRE(!writer.commit());
+
+      // Rounding this size up to the record alignment would wrap around to a small value
+      const std::uint64_t header = std::numeric_limits<std::uint64_t>::max() - 3;
+      const auto data_offset = static_cast<off_t>(::sysconf(_SC_PAGESIZE));
+      REQUIRE(::pwrite(ring.fd(), &header, sizeof(header), data_offset) == sizeof(header));
+
+      ring_reader reader{ring};
+      buffer::const_span_t view{};
+      REQUIRE(reader.peek(view) == error::ill_formed);
+   }
+
+   SECTION("Corrupted read position") {
+      shared_ring ring{};
+      REQUIRE(!ring.create(4096));
+
+      ring_writer writer{ring};
+      REQUIRE(!encode(writer, message{1, "first"}));
+      REQUIRE(!writer.commit());
+
+      // The consumer's read position (third cache line of the control page) overtakes the producer
+      const std::uint64_t read_position = 1024 * 1024;
+      REQUIRE(::pwrite(ring.fd(), &read_position, sizeof(read_position), 128) == sizeof(read_position));
+
+      REQUIRE(encode(writer, message{2, std::string(100, 'x')}) == error::ill_formed);
+      writer.discard();
+      REQUIRE(writer.commit() == error::ill_formed);
+   }
+}
+
+TEST_CASE("Shared ring - concurrent producer and consumer", "[shared_ring]") {
+   shared_ring ring{};
+   REQUIRE(!ring.create(4096));
+
+   constexpr std::uint64_t num_messages = 20000;
+
+   std::thread producer{[&ring] {
+      ring_writer writer{ring};
+      for (std::uint64_t i = 0; i < num_messages;) {
+         if (encode(writer, message{i, std::string(i % 64, 'x')})) {
+            // Ring is full, wait for the consumer
+            std::this_thread::yield();
+            continue;
+         }
+
+         if (writer.commit()) {
+            writer.discard();
+            std::this_thread::yield();
+            continue;
+         }
+         ++i;
+      }
+   }};
+
+   ring_reader reader{ring};
+   std::vector<std::uint64_t> ids{};
+   ids.reserve(num_messages);
+
+   bool valid = true;
+   while (ids.size() < num_messages) {
+      buffer::const_span_t view{};
+      if (reader.peek(view)) {
+         std::this_thread::yield();
+         continue;
+      }
+
+      read_buffer buf{view};
+      detail::head head{};
+      std::uint64_t id{};
+      std::string payload{};
+      valid = valid && !head.read(buf) && !cbor::decode(buf, id) && !cbor::decode(buf, payload);
+      valid = valid && payload.size() == id % 64;
+      ids.push_back(id);
+
+      reader.release();
+   }
+
+   producer.join();
+
+   REQUIRE(valid);
+   for (std::uint64_t i = 0; i < num_messages; ++i) {
+      REQUIRE(ids[i] == i);
+   }
+}
+
+#endif // CBOR_WITH(SHARED_MEMORY)
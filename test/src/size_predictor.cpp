@@ -0,0 +1,137 @@
+/**
+ * @file   size_predictor.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cbor/config.h>
+#include <cbor/decoding.h>
+#include <cbor/size_predictor.h>
+
+#include <test/encoding.h>
+
+#include <string>
+#include <vector>
+
+using namespace test;
+
+namespace {
+
+struct message {
+   std::uint64_t id;
+   std::string payload;
+
+   CBOR_FIELDS(message, id, payload)
+};
+
+struct other_message {
+   std::string payload;
+
+   CBOR_FIELDS(other_message, payload)
+};
+
+bool operator==(const message &lhs, const message &rhs) {
+   return lhs.id == rhs.id && lhs.payload == rhs.payload;
+}
+
+} // namespace
+
+template <>
+struct cbor::type_id<message> : std::integral_constant<std::uint64_t, 0x2A> {};
+
+TEST_CASE("Size predictor - keys", "[size_predictor]") {
+   REQUIRE(cbor::size_predictor::key_v<message> == 0x2A);
+   REQUIRE(cbor::size_predictor::key_v<const message &> == 0x2A);
+   REQUIRE(cbor::size_predictor::key_v<other_message> == cbor::schema_fingerprint_v<other_message>);
+}
+
+TEST_CASE("Size predictor - statistics", "[size_predictor]") {
+   cbor::size_predictor predictor{0.5};
+
+   REQUIRE(!predictor.stats<message>());
+   REQUIRE(predictor.predict<message>() == cbor::dynamic_buffer_initial_size);
+
+   predictor.record<message>(100);
+   auto stats = predictor.stats<message>();
+   REQUIRE(stats);
+   REQUIRE(stats->samples == 1);
+   REQUIRE(stats->mean == 100);
+   REQUIRE(stats->deviation == 0);
+   REQUIRE(predictor.predict<message>() == 100);
+
+   predictor.record<message>(200);
+   stats = predictor.stats<message>();
+   REQUIRE(stats->samples == 2);
+   REQUIRE(stats->mean == 150);
+   REQUIRE(stats->deviation == 50);
+   REQUIRE(stats->last == 200);
+   REQUIRE(stats->peak == 200);
+   REQUIRE(predictor.predict<message>() == 250);
+
+   SECTION("Types are tracked separately") {
+      REQUIRE(!predictor.stats<other_message>());
+      predictor.record<other_message>(10);
+      REQUIRE(predictor.predict<other_message>() == 10);
+      REQUIRE(predictor.all_stats().size() == 2);
+   }
+
+   SECTION("Reset") {
+      predictor.reset();
+      REQUIRE(predictor.all_stats().empty());
+      REQUIRE(!predictor.stats<message>());
+   }
+}
+
+TEST_CASE("Size predictor - encoding", "[size_predictor]") {
+   cbor::size_predictor predictor{};
+   const message value{1, std::string(300, 'x')};
+
+   std::vector<std::byte> first{};
+   REQUIRE(!predictor.encode(first, value));
+
+   auto stats = predictor.stats<message>();
+   REQUIRE(stats);
+   REQUIRE(stats->last == first.size());
+
+   SECTION("Subsequent messages are pre-reserved") {
+      std::vector<std::byte> second{};
+      REQUIRE(!predictor.encode(second, value));
+      REQUIRE(second == first);
+      REQUIRE(second.capacity() == first.size());
+   }
+
+   SECTION("Appending to a non-empty vector") {
+      std::vector<std::byte> target = first;
+      REQUIRE(!predictor.encode(target, value));
+      REQUIRE(target.size() == 2 * first.size());
+
+      message decoded{};
+      cbor::read_buffer buf{target};
+      REQUIRE(!cbor::decode(buf, decoded));
+      REQUIRE(!cbor::decode(buf, decoded));
+      REQUIRE(decoded == value);
+   }
+
+   SECTION("Appending many messages grows geometrically") {
+      std::vector<std::byte> target{};
+      std::size_t reallocations = 0;
+      for (std::size_t i = 0; i < 1000; ++i) {
+         const auto capacity = target.capacity();
+         REQUIRE(!predictor.encode(target, value));
+         if (target.capacity() != capacity) {
+            ++reallocations;
+         }
+      }
+
+      REQUIRE(target.size() == 1000 * first.size());
+      REQUIRE(reallocations <= 11);
+   }
+
+   SECTION("Failures are not recorded") {
+      std::vector<std::byte> target{};
+      REQUIRE(predictor.encode(target, value, 16) == cbor::error::buffer_overflow);
+      REQUIRE(predictor.stats<message>()->samples == 1);
+   }
+}
@@ -0,0 +1,90 @@
+/**
+ * @file   small_buffer.cpp
+ * @author Dennis Sitelew
+ * @date   Oct 18, 2026
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cbor/decoding.h>
+#include <cbor/encoding.h>
+#include <cbor/small_buffer.h>
+
+#include <test/encoding.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace test;
+
+TEST_CASE("Small buffer - inline storage", "[buffer, small_buffer]") {
+   const std::vector<std::string> value{"a", "b"};
+
+   cbor::small_buffer<16> buf{};
+   REQUIRE(!cbor::encode(buf, value));
+   REQUIRE(buf.is_inline());
+   REQUIRE(buf.size() == 5);
+
+   const auto expected = encode_to_vector(value);
+   REQUIRE(std::ranges::equal(buf.bytes(), expected));
+
+   SECTION("Release copies the inline contents") {
+      const auto released = buf.release();
+      REQUIRE(released == expected);
+      REQUIRE(buf.size() == 0);
+      REQUIRE(buf.bytes().empty());
+   }
+
+   SECTION("Clear") {
+      buf.clear();
+      REQUIRE(buf.size() == 0);
+      REQUIRE(!cbor::encode(buf, value));
+      REQUIRE(std::ranges::equal(buf.bytes(), expected));
+   }
+}
+
+TEST_CASE("Small buffer - spilling to the heap", "[buffer, small_buffer]") {
+   const std::vector<std::string> value{"first string", "second string", "third string"};
+   const auto expected = encode_to_vector(value);
+
+   cbor::small_buffer<8> buf{};
+   REQUIRE(!cbor::encode(buf, value));
+   REQUIRE(!buf.is_inline());
+   REQUIRE(std::ranges::equal(buf.bytes(), expected));
+
+   SECTION("Release moves the heap storage out") {
+      const auto *data = buf.bytes().data();
+      const auto released = buf.release();
+      REQUIRE(released == expected);
+      REQUIRE(released.data() == data);
+
+      REQUIRE(buf.is_inline());
+      REQUIRE(buf.size() == 0);
+   }
+
+   SECTION("Decoding from the buffer") {
+      std::vector<std::string> decoded{};
+      cbor::read_buffer read_buf{buf.bytes()};
+      REQUIRE(!cbor::decode(read_buf, decoded));
+      REQUIRE(decoded == value);
+   }
+}
+
+TEST_CASE("Small buffer - capacity limit and rollback", "[buffer, small_buffer, rollback]") {
+   const std::vector<std::string> value{"first string", "second string"};
+
+   SECTION("Inline rollback") {
+      cbor::small_buffer<64> buf{8};
+      REQUIRE(!cbor::encode(buf, std::uint8_t{1}));
+      REQUIRE(cbor::encode(buf, value) == cbor::error::buffer_overflow);
+      REQUIRE(buf.size() == 1);
+      REQUIRE(buf.is_inline());
+   }
+
+   SECTION("Heap rollback") {
+      cbor::small_buffer<4> buf{20};
+      REQUIRE(cbor::encode(buf, value) == cbor::error::buffer_overflow);
+      REQUIRE(buf.size() == 0);
+   }
+}